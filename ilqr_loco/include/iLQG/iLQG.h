@@ -6,6 +6,7 @@
 #endif
 
 #include "iLQG_problem.h"
+#include "thread_pool.h"
 
 #define INIT_OPTSET {0, 0, NULL, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, NULL, NULL, 0, 0.0, 0.0, 0.0, 0.0, 0.0, 0, 0.0, 0.0, 0.0, 0.0, 0, 0, NULL, NULL, NULL, {0.0, 0.0}, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, NULL, NULL}
 
@@ -24,6 +25,26 @@
 #define NUMBER_OF_THREADS 1
 #endif
 
+// time steps per derivative task in calc_derivs
+#ifndef DERIVS_CHUNK
+#define DERIVS_CHUNK 4
+#endif
+
+// candidates rolled out together in the vector lanes of forward_pass_batch
+#ifndef ROLLOUT_LANES
+#define ROLLOUT_LANES 4
+#endif
+
+// line search candidates: one batch of ROLLOUT_LANES per thread
+#define N_CANDIDATES (NUMBER_OF_THREADS*ROLLOUT_LANES)
+
+// iLQG() and plan_trajectory() results
+#define ILQG_FAILED        -1 // no valid trajectory, plan_trajectory() only
+#define ILQG_NOT_CONVERGED  0 // max_iter or lambdaMax reached, no descent direction, derivatives failed
+#define ILQG_CONVERGED      1
+#define ILQG_DEADLINE       2 // stopped at o->deadline, nominal is the best accepted trajectory
+#define ILQG_CANCELLED      3 // stopped by o->stop_check, nominal is the best accepted trajectory
+
 #define DO_PREFIX1(VAL)  1 ## VAL
 #define PREFIX1(VAL)     DO_PREFIX1(VAL)
 
@@ -34,6 +55,25 @@ typedef struct paramDesc {
   int is_var;
 } tParamDesc;
 
+// solver telemetry, recorded when tOptSet.stats is set; times are wall time [s]
+typedef struct {
+    double cost, dcost, lambda, g_norm;
+    int alpha_idx;          // accepted index into alpha, -1 if rejected
+    double t_derivs;        // with MULTI_THREADED only the part not hidden behind back_pass
+    double t_back_pass;
+    double t_line_search;
+} iterStats_t;
+
+typedef struct {
+    int max_iter;           // capacity of iter
+    iterStats_t *iter;
+    int n_iter;
+    int status;
+    double cost;            // cost of the returned trajectory
+    long n_allocs;          // heap allocations made by the solver during the plan
+    double t_total, t_derivs, t_back_pass, t_line_search;
+} solveStats_t;
+
 typedef struct optSet {
     int n_hor;
     int debug_level;
@@ -68,20 +108,50 @@ typedef struct optSet {
     double w_pen_fact2;
 
     traj_t *nominal;
-    traj_t *candidates[NUMBER_OF_THREADS];
+    traj_t *candidates[N_CANDIDATES];
 
-    traj_t trajectories[NUMBER_OF_THREADS+1];
+    traj_t trajectories[N_CANDIDATES+1];
+    derivEl_t *derivs;      // calc_derivs results along the nominal, n_hor steps
 
     multipliers_t multipliers;
+
+    threadPool_t *pool;
+
+    double deadline; // monotonic_time() at which iLQG() stops, <= 0: no deadline
+
+    // optional, asked before every iteration whether to give up on this solve
+    int (*stop_check)(struct optSet *o, void *arg);
+    void *stop_arg;
+
+    solveStats_t *stats;    // optional, NULL: nothing recorded
+    long n_allocs;          // heap allocations made for this context so far
+
+    int n_obs;              // obstacles in p[3], as x, y pairs
+    int obs_capacity;       // obstacles p[3] has room for, set before alloc_solver
+    double obs_cull_dist;   // obstacles farther from a state cost nothing, d_thres if smaller
+
+#if MULTI_THREADED
+    // derivative pipeline: steps k >= step_calc_done are ready for back_pass,
+    // step_calc_done < 0 flags a failed derivative
+    pthread_mutex_t step_mutex;
+    pthread_cond_t next_step_condition;
+    int step_calc_done;
+    int n_chunks_ready;
+    int *chunk_done;
+#endif
 } tOptSet;
 
+double monotonic_time();
 void printParams(double **p, int k);
 void standard_parameters(tOptSet *o);
 int iLQG(tOptSet *o);
 char *setOptParam(tOptSet *o, const char *name, const double *value, const int n);
 int forward_pass(traj_t *c, tOptSet *o, double alpha, double *csum, int cost_only);
+void forward_pass_batch(traj_t **c, tOptSet *o, const double *alpha, int n, double *csum, int *success);
+int simulate_controls(double x_end[], const double x0[], const double *u, const double *dt, int n, double **p);
 void makeCandidateNominal(tOptSet *o, int idx);
 int calc_derivs(tOptSet *o);
+void wait_derivs(tOptSet *o);
 int init_opt(tOptSet *o);
 int update_multipliers(tOptSet *o, int init);
 int get_g_size();
@@ -98,11 +168,5 @@ extern int n_params;
 extern int n_vars;
 extern tParamDesc *paramdesc[];
 
-#if MULTI_THREADED
-extern pthread_mutex_t step_mutex;
-extern pthread_cond_t  next_step_condition;
-extern int step_calc_done;
-#endif
-
 
 #endif /* ILQG_H */
@@ -21,40 +21,62 @@
 #define sizeofQuu 3 
 #define sizeofQxu 20 
 
+// ILQG_FLOAT=1 stores the derivatives of every time step in single precision
+// and runs the line search rollout lanes in single precision. States,
+// controls, gains and the back pass (Riccati recursion) stay double.
+#ifndef ILQG_FLOAT
+#define ILQG_FLOAT 0
+#endif
+
+#if ILQG_FLOAT
+typedef float deriv_t;
+typedef float roll_t;
+#else
+typedef double deriv_t;
+typedef double roll_t;
+#endif
+
+// One time step of a trajectory: what rollouts and the line search touch.
+// Every candidate trajectory has these.
 typedef struct {
     double x[N_X];
     double u[N_U];
+    double l[N_U];
+    double L[N_U*N_X]; 
+    double c;
+} trajEl_t;
+
+// What calc_derivs computes for one time step of the nominal trajectory and
+// back_pass consumes. Only the nominal has these, so tOptSet keeps a single
+// array of them instead of a copy in every trajectory.
+typedef struct {
     double lower[N_U];
     double upper[N_U];
     double lower_sign[N_U];
     double upper_sign[N_U];
     double lower_hx[N_X*N_U];
     double upper_hx[N_X*N_U];
-    
-    double l[N_U];
-    double L[N_U*N_X]; 
-    double c;
-    double cx[N_X];
-    double cxx[sizeofQxx];
-    double cu[N_U];
-    double cuu[sizeofQuu];
-    double cxu[sizeofQxu];
-    double fx[N_X*N_X];
-    double fu[N_X*N_U];
+
+    deriv_t cx[N_X];
+    deriv_t cxx[sizeofQxx];
+    deriv_t cu[N_U];
+    deriv_t cuu[sizeofQuu];
+    deriv_t cxu[sizeofQxu];
+    deriv_t fx[N_X*N_X];
+    deriv_t fu[N_X*N_U];
 #if FULL_DDP
-    double fxx[N_X*sizeofQxx];
-    double fuu[N_X*sizeofQuu];
-    double fxu[N_X*sizeofQxu];
+    deriv_t fxx[N_X*sizeofQxx];
+    deriv_t fuu[N_X*sizeofQuu];
+    deriv_t fxu[N_X*sizeofQxu];
 #endif
-
-} trajEl_t;
+} derivEl_t;
 
 typedef struct {
     double x[N_X];
 
     double c;
-    double cx[N_X];
-    double cxx[sizeofQxx];
+    deriv_t cx[N_X];
+    deriv_t cxx[sizeofQxx];
 
 
 } trajFin_t;
@@ -64,12 +86,15 @@ typedef struct {
     trajFin_t f;
 } traj_t;
 
+// Without constraints the multipliers are empty. An empty struct has size 0
+// in C but 1 in C++, which would move every tOptSet member after them in
+// traj_client; the placeholder gives both the same layout.
 typedef struct {
-
+    char unused;
 } multipliersEl_t;
 
 typedef struct {
-
+    char unused;
 } multipliersFin_t;
 
 typedef struct {
@@ -0,0 +1,67 @@
+#ifndef MATMULT_FIXED_H
+#define MATMULT_FIXED_H
+
+#include "iLQG_problem.h"
+#include "matMult.h"
+
+// Fixed size kernels for the back pass. Every matrix has N_X rows, n_c is
+// only ever passed as N_X or N_U, so after inlining all loop bounds are
+// compile time constants and the compiler unrolls and vectorizes them.
+// Symmetric matrices are expanded to full storage once instead of going
+// through SYMTRI_MAT_IDX in the inner loops. The dynamics Jacobians come in
+// as deriv_t and are widened in the products, the sums are always double.
+
+// full= tri; tri: upper triangle of a symmetric [N_X x N_X]
+static inline void triToFull_x(double full[], const double tri[]) {
+    int ri, ci;
+
+    for(ci= 0; ci<N_X; ci++)
+        for(ri= 0; ri<=ci; ri++)
+            full[MAT_IDX(ri, ci, N_X)]= full[MAT_IDX(ci, ri, N_X)]= tri[UTRI_MAT_IDX(ri, ci)];
+}
+
+// c= a*b; a= [N_X x N_X]; b= [N_X x n_c]
+static inline void mulSquare_x(double c[], const double a[], const deriv_t b[], const int n_c) {
+    int ci, ri, si;
+
+    for(ci= 0; ci<n_c; ci++) {
+        for(ri= 0; ri<N_X; ri++)
+            c[MAT_IDX(ri, ci, N_X)]= 0.0;
+        for(si= 0; si<N_X; si++)
+            for(ri= 0; ri<N_X; ri++)
+                c[MAT_IDX(ri, ci, N_X)]+= a[MAT_IDX(ri, si, N_X)]*b[MAT_IDX(si, ci, N_X)];
+    }
+}
+
+// base= base + a'*b; base= [n_ca x n_cb]; a= [N_X x n_ca]; b= [N_X x n_cb]
+static inline void addMulT_x(double base[], const deriv_t a[], const int n_ca, const double b[], const int n_cb) {
+    int ci, ri, si;
+    double d;
+
+    for(ci= 0; ci<n_cb; ci++)
+        for(ri= 0; ri<n_ca; ri++) {
+            d= 0.0;
+            for(si= 0; si<N_X; si++)
+                d+= a[MAT_IDX(si, ri, N_X)]*b[MAT_IDX(si, ci, N_X)];
+            base[MAT_IDX(ri, ci, n_ca)]+= d;
+        }
+}
+
+// base= base + a'*b symmetrized like addSquareTri; base: upper triangle of [n_c x n_c]; a, b= [N_X x n_c]
+static inline void addMulTTri_x(double base[], const deriv_t a[], const double b[], const int n_c) {
+    int ci, ri, si;
+    double s, st;
+
+    for(ci= 0; ci<n_c; ci++)
+        for(ri= 0; ri<=ci; ri++) {
+            s= 0.0;
+            st= 0.0;
+            for(si= 0; si<N_X; si++) {
+                s+= a[MAT_IDX(si, ri, N_X)]*b[MAT_IDX(si, ci, N_X)];
+                st+= a[MAT_IDX(si, ci, N_X)]*b[MAT_IDX(si, ri, N_X)];
+            }
+            base[UTRI_MAT_IDX(ri, ci)]+= (ri==ci)? s: 0.5*(s + st);
+        }
+}
+
+#endif // MATMULT_FIXED_H
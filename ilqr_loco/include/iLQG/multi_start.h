@@ -0,0 +1,43 @@
+#ifndef MULTISTART_H
+#define MULTISTART_H
+
+#include "iLQG.h"
+#include "iLQG_plan.h"
+
+// Solves the same problem from several initial control sequences at once,
+// one solver context per start, and keeps the lowest cost trajectory.
+// Starts run as tasks on a thread pool with single threaded contexts. Once
+// a start has finished, starts whose cost is still more than cancel_margin
+// above it are cancelled.
+
+typedef struct {
+    tOptSet opt;
+    double **p;                 // own parameter table, Obs and xDes are per context
+    struct trajectory traj;     // traj.u holds the seed on entry
+    int status;
+    solveStats_t stats;         // recorded if the prototype records stats
+} msStart_t;
+
+typedef struct {
+    int n_starts;
+    int n_hor;
+    msStart_t *starts;
+    double cancel_margin;
+
+    // per plan
+    double *x0, *xDes, *Obs;
+    int n_obs;
+    double deadline;
+    double best_finished_cost;
+    int n_finished;
+#if MULTI_THREADED
+    pthread_mutex_t mutex;
+#endif
+} multiStart_t;
+
+multiStart_t *multi_start_create(const tOptSet *proto, int n_starts, int T, double cancel_margin);
+void multi_start_destroy(multiStart_t *ms);
+double *multi_start_seed(multiStart_t *ms, int idx);
+int multi_start_plan(multiStart_t *ms, double* x0, double* xDes, double* Obs, int n_obs, double deadline, threadPool_t *pool, int *best);
+
+#endif /* MULTISTART_H */
@@ -0,0 +1,44 @@
+#ifndef PRIMITIVECACHE_H
+#define PRIMITIVECACHE_H
+
+#include "iLQG.h"
+
+// On-disk library of converged solutions, memory mapped so it persists
+// across runs and costs no load time. Entries are looked up by the start
+// state and obstacle they were solved for, to warm start new solves close
+// to an optimum.
+//
+// File layout: pcHeader_t, then the raw keys of all slots packed together
+// for the nearest neighbour scan, then one pcEntry for every slot.
+
+#define PC_KEY_DIM 8    // x, y, yaw, Ux, Uy, r of x0, then Obs x, y
+#define PC_MAGIC "ILQGPC1"
+
+typedef struct {
+    char magic[8];
+    int n_x, n_u, T;
+    int capacity;
+    int count;
+    int next;           // slot replaced once the library is full
+} pcHeader_t;
+
+typedef struct {
+    pcHeader_t *header;
+    double *keys;       // [capacity x PC_KEY_DIM]
+    double *entries;    // [capacity x stride]: cost, u [N_U x T], x [N_X x (T+1)]
+    int stride;
+    double scale[PC_KEY_DIM];
+    double merge_dist;  // a new solution closer than this to an entry replaces it, whatever the costs
+    void *map;
+    size_t map_size;
+} primitiveCache_t;
+
+primitiveCache_t *primitive_cache_open(const char *path, int T, int capacity, const double *scale, double merge_dist);
+void primitive_cache_close(primitiveCache_t *pc);
+int primitive_cache_nearest(const primitiveCache_t *pc, const double *x0, const double *Obs, double *dist);
+const double *primitive_cache_u(const primitiveCache_t *pc, int idx);
+const double *primitive_cache_x(const primitiveCache_t *pc, int idx);
+double primitive_cache_cost(const primitiveCache_t *pc, int idx);
+void primitive_cache_insert(primitiveCache_t *pc, const double *x0, const double *Obs, double cost, const double *u, const double *x);
+
+#endif /* PRIMITIVECACHE_H */
@@ -0,0 +1,21 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+// Persistent worker pool for the iLQG solver. Workers are started once and
+// sleep between batches; a batch is a set of n_tasks independent calls
+// task(arg, idx) with idx in [0..n_tasks). The calling thread takes part in
+// the batch while waiting for it, so a pool with n workers runs up to n+1
+// tasks at once. A NULL pool runs every task on the calling thread.
+
+typedef void (*poolTask_t)(void *arg, int idx);
+
+typedef struct threadPool threadPool_t;
+
+threadPool_t *thread_pool_create(int n_workers);
+void thread_pool_destroy(threadPool_t *tp);
+int thread_pool_size(const threadPool_t *tp);
+void thread_pool_start(threadPool_t *tp, poolTask_t task, void *arg, int n_tasks);
+void thread_pool_wait(threadPool_t *tp);
+void thread_pool_run(threadPool_t *tp, poolTask_t task, void *arg, int n_tasks);
+
+#endif /* THREADPOOL_H */
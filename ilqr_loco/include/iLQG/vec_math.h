@@ -0,0 +1,89 @@
+#ifndef VEC_MATH_H
+#define VEC_MATH_H
+
+// Branch free sin and cos for loops over rollout lanes. No table lookups,
+// libm calls or data dependent branches, so a loop over lanes calling these
+// vectorizes. Accurate to a few ulp for |x| < 1e5.
+
+// fdlibm __kernel_sin and __kernel_cos coefficients on [-pi/4, pi/4]
+#define VM_S1 -1.66666666666666324348e-01
+#define VM_S2  8.33333333332248946124e-03
+#define VM_S3 -1.98412698298579493134e-04
+#define VM_S4  2.75573137070700676789e-06
+#define VM_S5 -2.50507602534068634195e-08
+#define VM_S6  1.58969099521155010221e-10
+
+#define VM_C1  4.16666666666666019037e-02
+#define VM_C2 -1.38888888888741095749e-03
+#define VM_C3  2.48015872894767294178e-05
+#define VM_C4 -2.75573143513906633035e-07
+#define VM_C5  2.08757232129817482790e-09
+#define VM_C6 -1.13596475577881948265e-11
+
+// pi/2 split in three parts for exact n*pi/2 subtraction (Cody-Waite)
+#define VM_PIO2_1   1.57079632673412561417e+00
+#define VM_PIO2_2   6.07710050630396597660e-11
+#define VM_PIO2_2T  2.02226624879595063154e-21
+#define VM_INVPIO2  6.36619772367581382433e-01
+// adding and subtracting 1.5*2^52 rounds to the nearest integer
+#define VM_ROUND    6755399441055744.0
+
+static inline void sincos_lane(double x, double *s, double *c) {
+    double n, r, z, ps, pc, sq, cq;
+    int q;
+
+    n= (x*VM_INVPIO2 + VM_ROUND) - VM_ROUND;
+    r= ((x - n*VM_PIO2_1) - n*VM_PIO2_2) - n*VM_PIO2_2T;
+    q= (int) n;
+
+    z= r*r;
+    ps= r + r*z*(VM_S1 + z*(VM_S2 + z*(VM_S3 + z*(VM_S4 + z*(VM_S5 + z*VM_S6)))));
+    pc= 1.0 - 0.5*z + z*z*(VM_C1 + z*(VM_C2 + z*(VM_C3 + z*(VM_C4 + z*(VM_C5 + z*VM_C6)))));
+
+    // quadrant q: sin(r + q*pi/2)
+    sq= (q & 1)? pc: ps;
+    cq= (q & 1)? ps: pc;
+    *s= (q & 2)? -sq: sq;
+    *c= ((q+1) & 2)? -cq: cq;
+}
+
+// single precision variant, a few ulp for |x| < 100
+
+// FreeBSD __kernel_sindf and __kernel_cosdf coefficients on [-pi/4, pi/4]
+#define VM_S1F -0.166666666416265235595f
+#define VM_S2F  0.0083333293858894631756f
+#define VM_S3F -0.000198393348360966317347f
+#define VM_S4F  0.0000027183114939898219064f
+
+#define VM_C0F -0.499999997251031003120f
+#define VM_C1F  0.0416666233237390631894f
+#define VM_C2F -0.00138867637746099294692f
+#define VM_C3F  0.0000243904487962774090654f
+
+// pi/2 split with 17 and 24 bit parts (fdlibm __ieee754_rem_pio2f)
+#define VM_PIO2_1F   1.5707855225e+00f
+#define VM_PIO2_2F   1.0804273188e-05f
+#define VM_PIO2_2TF  6.0770999344e-11f
+#define VM_INVPIO2F  6.3661974669e-01f
+// 1.5*2^23
+#define VM_ROUNDF    12582912.0f
+
+static inline void sincos_lanef(float x, float *s, float *c) {
+    float n, r, z, ps, pc, sq, cq;
+    int q;
+
+    n= (x*VM_INVPIO2F + VM_ROUNDF) - VM_ROUNDF;
+    r= ((x - n*VM_PIO2_1F) - n*VM_PIO2_2F) - n*VM_PIO2_2TF;
+    q= (int) n;
+
+    z= r*r;
+    ps= r + r*z*(VM_S1F + z*(VM_S2F + z*(VM_S3F + z*VM_S4F)));
+    pc= 1.0f + z*(VM_C0F + z*(VM_C1F + z*(VM_C2F + z*VM_C3F)));
+
+    sq= (q & 1)? pc: ps;
+    cq= (q & 1)? ps: pc;
+    *s= (q & 2)? -sq: sq;
+    *c= ((q+1) & 2)? -cq: cq;
+}
+
+#endif // VEC_MATH_H
@@ -43,7 +43,9 @@ struct trajectory {
 };
 
 double* assignPtrVal(double* values, int numVal);
-void init_params(tOptSet *o, double* xDes, double* Obs);
-void plan_trajectory(double* x0, double* u0, double* xDes, double* Obs, int T,  tOptSet *o, struct trajectory* Traj);
+void init_params(tOptSet *o, double* xDes, double* Obs, int n_obs);
+int alloc_solver(tOptSet *o, int T);
+void free_solver(tOptSet *o);
+int plan_trajectory(double* x0, double* u0, double* xDes, double* Obs, int n_obs, int T, double deadline, tOptSet *o, struct trajectory* Traj);
 
 #endif
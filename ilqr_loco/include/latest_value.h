@@ -0,0 +1,74 @@
+//
+// MIT License
+//
+// Copyright (c) 2017 MRSD Team D - LoCo
+// The Robotics Institute, Carnegie Mellon University
+// http://mrsdprojects.ri.cmu.edu/2016teamd/
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef _LATEST_VALUE_H_
+#define _LATEST_VALUE_H_
+
+#include <atomic>
+
+// Lock-free single producer, single consumer mailbox that only keeps the
+// newest value (triple buffer). Post never waits for the consumer and Fetch
+// never waits for the producer; values posted between two fetches are
+// overwritten, not queued.
+template <typename T>
+class LatestValue
+{
+public:
+  LatestValue(): back_(0), middle_(1), front_(2), received_(false) {}
+
+  // Producer side
+  void Post(const T &value)
+  {
+    slots_[back_] = value;
+    back_ = middle_.exchange(back_ | kFresh, std::memory_order_acq_rel) & kIndex;
+  }
+
+  // Consumer side: copies the newest value into value. Returns false if
+  // nothing was ever posted, value is left untouched then.
+  bool Fetch(T &value)
+  {
+    if (middle_.load(std::memory_order_relaxed) & kFresh)
+    {
+      front_ = middle_.exchange(front_, std::memory_order_acq_rel) & kIndex;
+      received_ = true;
+    }
+    if (received_)
+      value = slots_[front_];
+    return received_;
+  }
+
+private:
+  static const int kIndex = 3;
+  static const int kFresh = 4;   // set in middle_ when the producer swapped in a new value
+
+  T slots_[3];
+  int back_;                     // owned by the producer
+  std::atomic<int> middle_;      // slot index plus kFresh, shared
+  int front_;                    // owned by the consumer
+  bool received_;
+};
+
+#endif
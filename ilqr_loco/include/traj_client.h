@@ -29,11 +29,21 @@
 
 #include <vector>
 #include <math.h>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
 
 #include <ilqr_loco/TrajExecAction.h>
 #include <nav_msgs/Odometry.h>
 #include <geometry_msgs/Point.h>
+#include <geometry_msgs/PoseArray.h>
+#include <loco_msgs/SolverStats.h>
+#include <loco_msgs/Trajectory.h>
 #include "try_get_param.h"
+#include "latest_value.h"
+#include "traj_executor.h"
 
 #include <ros/ros.h>
 #include <tf/transform_listener.h>
@@ -46,6 +56,8 @@
 extern "C"{
   #include "iLQG.h"
   #include "iLQG_plan.h"
+  #include "multi_start.h"
+  #include "primitive_cache.h"
 }
 
 #define PI 3.1415926535
@@ -56,24 +68,52 @@ public:
   bool ramp_goal_flag_;
 
   TrajClient();
+  virtual ~TrajClient();
 
 protected:
   // ROS Handles
   ros::NodeHandle nh;
   ros::Subscriber state_sub_;
   ros::Subscriber obs_sub_;
+  ros::Subscriber obstacles_sub_;
   ros::Subscriber mode_sub_;
   ros::Publisher predicted_state_pub_;
+  ros::Publisher solver_stats_pub_;
   actionlib::SimpleActionClient<ilqr_loco::TrajExecAction> ac_;
+  std::mutex ac_mutex_;           // guards goals sent on ac_
+  TrajExecutor *executor_;        // executes plans in this process, NULL to use traj_server
+  bool exec_in_process_;
 
   // ilqr parameters and saved data
   int T_horizon_;
   std::vector<double> init_control_seq_;
   std::vector<double> u_seq_saved_;
-  std::vector<double> x_traj_saved_;
   std::vector<double> x_des_;
   tOptSet Opt;
 
+  // Multi-start: previous solution plus library seeds, NULL if no seeds
+  multiStart_t *multi_start_;
+  std::vector<std::string> multi_start_seeds_;        // param namespaces of the seeds
+  std::vector<std::vector<double> > seed_library_;    // seeds fitted to T_horizon_
+  double multi_start_cancel_margin_;
+
+  // Converged solutions by start state and obstacle, NULL if disabled
+  primitiveCache_t *primitive_cache_;
+  std::string primitive_cache_file_;      // empty to disable
+  int primitive_cache_size_;
+  double primitive_cache_max_dist_;       // farthest entry still used as warm start
+  double primitive_cache_merge_dist_;
+  std::vector<double> primitive_cache_scale_;
+
+  // Solver telemetry of the last plan
+  solveStats_t solve_stats_;
+  std::vector<iterStats_t> iter_stats_;
+  std::string solver_log_file_;   // binary log of every plan, empty for none
+  FILE *solver_log_;
+  std::string scenario_log_file_; // plan inputs as benchmark scenarios, empty for none
+  FILE *scenario_log_;
+  int scenario_count_;            // plans logged so far, keeps scenario keys unique
+
   // iLQR Opt.p: Car Params
   double g_, L_, m_, b_, a_, G_f_, G_r_, c_x_, c_a_, Iz_, mu_, mu_s_;
   std::vector<double> limThr_;
@@ -91,10 +131,12 @@ protected:
   double k_pos_;                  // Obstacle pos cost
   double k_vel_;                  // Obstacle vel cost
   double d_thres_;                // Obstacle threshold
+  double obs_cull_dist_;          // Obstacles farther from a state are skipped
+  int max_obstacles_;             // Plans keep this many obstacles nearest the start
 
   // Helper variables
-  int T_;                         // Sequence ID number (starts from 0, in lifetime of client)
-  int mode_;                      // Operation mode from keyboard teleop
+  std::atomic<int> T_;            // Sequence ID number (starts from 0, in lifetime of client)
+  std::atomic<int> mode_;         // Operation mode from keyboard teleop
   ros::Time start_time_;          // Operation start time
   bool state_estimate_received_;  // Initial estimate flag
   bool obs_received_;
@@ -104,6 +146,23 @@ protected:
   nav_msgs::Odometry cur_state_;
   nav_msgs::Odometry prev_state_;
   geometry_msgs::Point obs_pos_;
+  std::vector<geometry_msgs::Point> obstacles_;   // newest obstacle set, map frame
+
+  // Planner thread. Callbacks post the newest state and obstacles and request
+  // a plan; the solver only ever runs on planner_thread_, from the snapshot
+  // in plan_state_ and plan_obs_.
+  std::thread planner_thread_;
+  LatestValue<nav_msgs::Odometry> state_mailbox_;
+  LatestValue<std::vector<geometry_msgs::Point> > obs_mailbox_;
+  std::atomic<int> plan_request_;       // mode to plan for, -1 for none
+  std::atomic<bool> reset_seq_;         // restart from init_control_seq_ on the next plan
+  std::atomic<bool> planner_shutdown_;
+  std::mutex planner_mutex_;            // only guards the wakeup, never held while solving
+  std::condition_variable planner_cond_;
+  nav_msgs::Odometry plan_state_;
+  std::vector<geometry_msgs::Point> plan_obs_;
+  std::vector<double> plan_obs_xy_;     // plan_obs_ as the solver's x, y pairs
+  std::vector<std::pair<double, int> > plan_obs_order_;  // squared distance to the start, index
 
   // Ramp up
   double cur_integral_;
@@ -130,47 +189,72 @@ protected:
   int ilqr_max_iter_;
   int ilqr_regType_;
   int ilqr_debug_level_;
+  double ilqr_max_time_;          // Solver time budget per plan [s], 0 for none
   std::vector<double> replan_times_;
   double replan_rate_;
-  int step_on_last_traj_;
+  std::atomic<int> step_on_last_traj_;
   int use_extrapolate_;
-  double extrapolate_dt_;
+  double extrapolate_dt_;         // initial latency estimate [s]
+  double latency_filter_gain_;
+
+  // Latency from state estimate to execution of a plan built on it, filtered
+  // over the first feedback of each plan
+  std::atomic<double> latency_est_;
+  std::atomic<double> latency_probe_;   // state stamp of the plan awaiting its first feedback, 0 for none
+  loco_msgs::TrajectoryConstPtr last_traj_;   // last trajectory sent, what the car is executing
+  std::mutex last_traj_mutex_;
 
   void LoadParams();
   void LoadCarParams();
   void LoadCostParams();
   void SetOptParams(tOptSet *o);
   void LoadOpt();
+  void LoadSeedLibrary();
+  void LoadPrimitiveCache();
+  virtual void PublishSolverStats(const solveStats_t &stats, int seed);
+  void LogScenario(const nav_msgs::Odometry &x_start, const double *x0, const std::vector<double> &x_des,
+                   const std::vector<geometry_msgs::Point> &obstacles);
 
   void rampPlan();
-  ilqr_loco::TrajExecGoal rampGenerateTrajectory(nav_msgs::Odometry prev_state_,
+  loco_msgs::TrajectoryPtr rampGenerateTrajectory(nav_msgs::Odometry prev_state_,
                                                  nav_msgs::Odometry cur_state_);
 
+  void RequestPlan(int mode);
+  void PlannerLoop();
+  bool FetchSnapshot();
+
   void PlanFromCurrentStateILQR();
   void PlanFromExtrapolatedILQR();
-  ilqr_loco::TrajExecGoal GenTrajILQR(nav_msgs::Odometry &x_cur, std::vector<double> &u_init,
-          std::vector<double> &x_des, geometry_msgs::Point &obstacle_pos);
+  void StopAfterFailedPlan();
+  // empty if the solver found no trajectory
+  loco_msgs::TrajectoryPtr GenTrajILQR(nav_msgs::Odometry &x_cur, std::vector<double> &u_init,
+          std::vector<double> &x_des, const std::vector<geometry_msgs::Point> &obstacles);
   void MpcILQR();
   void FixedRateReplanILQR();
-  double DistToGoal();
-  nav_msgs::Odometry ExtrapolateState(const nav_msgs::Odometry &state);
+  double DistToGoal(const nav_msgs::Odometry &state);
+  nav_msgs::Odometry PredictStartState(const nav_msgs::Odometry &state, const ros::Time &start);
+  void RecordLatency(int step);
 
-  void SendZeroCommand();
-  void SendTrajectory(ilqr_loco::TrajExecGoal &goal);
+  void SendZeroCommand(const nav_msgs::Odometry &state);
+  void SendTrajectory(const loco_msgs::TrajectoryConstPtr &traj);
   void SendInitControlSeq();
 
 
   void stateCb(const nav_msgs::Odometry &msg);
   void obsCb(const geometry_msgs::PointStamped &msg);
+  void obstaclesCb(const geometry_msgs::PoseArray &msg);
+  void ObstaclesReceived();
   void modeCb(const geometry_msgs::Point &msg);
 
-  void FillGoalMsgHeader(ilqr_loco::TrajExecGoal &goal);
-  void FillTwistMsg(geometry_msgs::Twist &twist, double lin_x, double ang_z);
-  void FillOdomMsg(nav_msgs::Odometry &odom, double x, double y,
-                   double yaw, double Ux, double Uy, double w);
+  loco_msgs::TrajectoryPtr NewTrajectory(int n_commands, int n_x);
+  void SetCommand(loco_msgs::Trajectory &traj, int i, double lin_x, double ang_z);
+  void SetState(loco_msgs::Trajectory &traj, int i, double x, double y,
+                double yaw, double Ux, double Uy, double w);
+  void SetState(loco_msgs::Trajectory &traj, int i, const nav_msgs::Odometry &odom);
 
   //  void activeCb();
    void feedbackCb(const ilqr_loco::TrajExecFeedbackConstPtr& feedback);
+   void executorFeedbackCb(const loco_msgs::TrajectoryConstPtr &traj, int step);
   //  void doneCb(const actionlib::SimpleClientGoalState& state,
               //  const ilqr_loco::TrajExecResultConstPtr& result);
 
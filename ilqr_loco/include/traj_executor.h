@@ -0,0 +1,117 @@
+//
+// MIT License
+//
+// Copyright (c) 2017 MRSD Team D - LoCo
+// The Robotics Institute, Carnegie Mellon University
+// http://mrsdprojects.ri.cmu.edu/2016teamd/
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef _TRAJ_EXECUTOR_H_
+#define _TRAJ_EXECUTOR_H_
+
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include <ros/ros.h>
+#include <boost/function.hpp>
+#include <geometry_msgs/Twist.h>
+#include <nav_msgs/Odometry.h>
+#include <nav_msgs/Path.h>
+#include <loco_msgs/Trajectory.h>
+
+#include "try_get_param.h"
+
+// Plays trajectories back on cmd_vel from a thread of its own. Used by
+// traj_server behind the action interface, and by traj_client directly when
+// it executes in process, in which case plans reach it by shared pointer
+// without being serialized.
+//
+// With exec_rate 0, one command is sent per timestep and a submitted
+// trajectory replaces the running one at its next command. Otherwise the
+// thread runs at exec_rate on absolute deadlines and sends the command
+// interpolated at the current time along the trajectory, counted from its
+// header stamp. A submitted trajectory takes over at its stamp, at the
+// matching time index, and is blended in over exec_blend_time.
+class TrajExecutor
+{
+public:
+  // Called from the executor thread with the trajectory being executed and
+  // the index of the command just sent on it. Until a submitted trajectory
+  // takes over, the steps are those of the one it replaces.
+  typedef boost::function<void(const loco_msgs::TrajectoryConstPtr &, int)> FeedbackCallback;
+
+  TrajExecutor(FeedbackCallback feedback_cb);
+  ~TrajExecutor();
+
+  // false, and traj is dropped, if its array lengths do not match n_x/n_u
+  bool Submit(const loco_msgs::TrajectoryConstPtr &traj);
+  void Cancel();
+  // true while traj is waiting or being executed
+  bool Executing(const loco_msgs::TrajectoryConstPtr &traj);
+
+private:
+  ros::NodeHandle nh;
+  ros::Publisher cmd_pub_;
+  ros::Publisher path_pub_;
+  ros::Subscriber state_sub_;
+  FeedbackCallback feedback_cb_;
+
+  // If a command was planned to be executed more than this many seconds ago,
+  // it is skipped.
+  double old_msg_thres_;
+  double exec_rate_;              // [Hz], 0 for one command per timestep
+  double blend_time_;             // [s]
+  int rt_priority_;               // SCHED_FIFO priority of the thread, 0 to keep the default
+
+  // PID heading correction
+  std::atomic<double> cur_yaw_;   // from stateCb
+  double cur_integral_;
+  double prev_error_;
+  float kp_, ki_, kd_;
+
+  std::thread thread_;
+  std::mutex mutex_;
+  std::condition_variable cond_;
+  loco_msgs::TrajectoryConstPtr pending_;   // next trajectory, guarded by mutex_
+  loco_msgs::TrajectoryConstPtr current_;   // guarded by mutex_ for Executing
+  bool cancel_;
+  bool shutdown_;
+
+  void LoadParams();
+  void Run();
+  void ExecuteTrajectory(const loco_msgs::TrajectoryConstPtr &traj);
+  void RunRealTime();
+  int Sample(const loco_msgs::Trajectory &traj, double tau, geometry_msgs::Twist &twist, double &yaw_des);
+  bool Preempted();
+  bool CheckLengths(const loco_msgs::Trajectory &traj);
+  geometry_msgs::Twist PidCorrectYaw(const geometry_msgs::Twist &orig_twist, double yaw_des, double dt);
+  void PublishPath(const loco_msgs::Trajectory &traj);
+  void stateCb(const nav_msgs::Odometry &msg);
+
+  double clamp(double val, double min_val, double max_val)
+  {
+    return std::max(min_val, std::min(val, max_val));
+  }
+};
+
+#endif
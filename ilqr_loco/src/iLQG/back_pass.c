@@ -20,6 +20,7 @@
 #include "back_pass.h"
 #include "iLQG.h"
 #include "matMult.h"
+#include "matMult_fixed.h"
 #include "boxQP.h"
 #include "printMat.h"
 
@@ -34,6 +35,14 @@
 #define TRACE(x) do { if (DEBUG_BACKPASS) PRNT x; } while (0)
 #define printVec_(x) do { if (DEBUG_BACKPASS) printVec x; } while (0)
 #define printMat_(x) do { if (DEBUG_BACKPASS) printMat x; } while (0)
+
+// dst= src; the stored derivatives may be single precision, the recursion runs in double
+static inline void widen(double dst[], const deriv_t src[], const int n) {
+    int i;
+
+    for(i= 0; i<n; i++)
+        dst[i]= src[i];
+}
    
 int back_pass(tOptSet *o) {
     double d1, g_norm_i, g_norm_max, g_norm_sum;
@@ -46,7 +55,9 @@ int back_pass(tOptSet *o) {
     double Qxu_reg[sizeofQxu], Qxu[sizeofQxu];
     double QuuF[sizeofQuu], Quu[sizeofQuu];
     double dummy[N_X*N_X];
+    double VxxF[N_X*N_X], Vfx[N_X*N_X], Vfu[N_X*N_U];
     trajEl_t *t= o->nominal->t + N - 1;
+    derivEl_t *d= o->derivs + N - 1;
     trajFin_t *f= &o->nominal->f;
     
     g_norm_sum= 0.0;
@@ -55,77 +66,82 @@ int back_pass(tOptSet *o) {
     o->dV[1]= 0.0;
     
 #if MULTI_THREADED  
-    pthread_mutex_lock(&step_mutex);
-        while(step_calc_done>N)
-            pthread_cond_wait(&next_step_condition, &step_mutex);
-    pthread_mutex_unlock(&step_mutex);
-    if(step_calc_done<0)
+    pthread_mutex_lock(&o->step_mutex);
+        while(o->step_calc_done>N)
+            pthread_cond_wait(&o->next_step_condition, &o->step_mutex);
+    pthread_mutex_unlock(&o->step_mutex);
+    if(o->step_calc_done<0)
         return 2;
 #endif
 
-    memcpy(Vx, f->cx, sizeof(double)*N_X);
-    memcpy(Vxx, f->cxx, sizeof(double)*sizeofQxx);
+    widen(Vx, f->cx, N_X);
+    widen(Vxx, f->cxx, sizeofQxx);
 
-    for(k= N-1; k>=0; k--, t--) {
+    for(k= N-1; k>=0; k--, t--, d--) {
 #if MULTI_THREADED  
-        pthread_mutex_lock(&step_mutex);
-            while(step_calc_done>k)
-                pthread_cond_wait(&next_step_condition, &step_mutex);
-        pthread_mutex_unlock(&step_mutex);
-        if(step_calc_done<0)
+        pthread_mutex_lock(&o->step_mutex);
+            while(o->step_calc_done>k)
+                pthread_cond_wait(&o->next_step_condition, &o->step_mutex);
+        pthread_mutex_unlock(&o->step_mutex);
+        if(o->step_calc_done<0)
             return 2;
 #endif
 //         TRACE(("k: %d\n", k));
 //         TRACE(("Qu=\n"));
         // Qu  = cu(:,i)      + fu(:,:,i)'*Vx(:,i+1);
-        memcpy(Qu, t->cu, sizeof(double)*N_U);
-        addMulVec(Qu, Vx, t->fu, N_X, N_U);
+        widen(Qu, d->cu, N_U);
+        addMulT_x(Qu, d->fu, N_U, Vx, 1);
 
 //         TRACE(("Qx=\n"));
         // Qx  = cx(:,i)      + fx(:,:,i)'*Vx(:,i+1);
-        memcpy(Qx, t->cx, sizeof(double)*N_X);
-        addMulVec(Qx, Vx, t->fx, N_X, N_X);
+        widen(Qx, d->cx, N_X);
+        addMulT_x(Qx, d->fx, N_X, Vx, 1);
+
+        // Vxx(:,:,i+1)*fx(:,:,i) and Vxx(:,:,i+1)*fu(:,:,i) are shared by Qxu, Quu and Qxx
+        triToFull_x(VxxF, Vxx);
+        mulSquare_x(Vfx, VxxF, d->fx, N_X);
+        mulSquare_x(Vfu, VxxF, d->fu, N_U);
 
 //         TRACE(("Qxu=\n"));
         // Qux = cxu(:,:,i)'  + fu(:,:,i)'*Vxx(:,:,i+1)*fx(:,:,i);
-        memcpy(Qxu, t->cxu, sizeof(double)*sizeofQxu);
-        addMul2Tri(Qxu, Vxx, t->fx, N_X, N_X, t->fu, N_X, N_U, dummy);
+        widen(Qxu, d->cxu, sizeofQxu);
+        addMulT_x(Qxu, d->fx, N_X, Vfu, N_U);
         // fxuVx = vectens(Vx(:,i+1),fxu(:,:,:,i));
         // Qux   = Qux + fxuVx;
 #if FULL_DDP
         for(j_= 0; j_<N_X*N_U; j_++) { // x, u
             d1= 0.0;
             for(i_= 0, k_= 0; i_<N_X; i_++, k_+= N_X*N_U) // f
-                d1+= Vx[i_]*t->fxu[j_+k_];
+                d1+= Vx[i_]*d->fxu[j_+k_];
             Qxu[j_]+= d1;
         }
 #endif
 //         TRACE(("Quu=\n"));
         // Quu = cuu(:,:,i)   + fu(:,:,i)'*Vxx(:,:,i+1)*fu(:,:,i);
-        memcpy(Quu, t->cuu, sizeof(double)*sizeofQuu);
-        addSquareTri(Quu, Vxx, t->fu, N_X, N_U, dummy);
+        widen(Quu, d->cuu, sizeofQuu);
+        addMulTTri_x(Quu, d->fu, Vfu, N_U);
         // fuuVx = vectens(Vx(:,i+1),fuu(:,:,:,i));
         // Quu   = Quu + fuuVx;
 #if FULL_DDP
         for(j_= 0; j_<sizeofQuu; j_++) { // u, u
             d1= 0.0;
             for(i_= 0, k_= 0; i_<N_X; i_++, k_+= sizeofQuu) // f
-                d1+= Vx[i_]*t->fuu[j_+k_];
+                d1+= Vx[i_]*d->fuu[j_+k_];
             Quu[j_]+= d1;
         }                
 #endif
         
 //         TRACE(("Qxx=\n"));
         // Qxx = cxx(:,:,i)   + fx(:,:,i)'*Vxx(:,:,i+1)*fx(:,:,i);
-        memcpy(Qxx, t->cxx, sizeof(double)*sizeofQxx);
-        addSquareTri(Qxx, Vxx, t->fx, N_X, N_X, dummy);
+        widen(Qxx, d->cxx, sizeofQxx);
+        addMulTTri_x(Qxx, d->fx, Vfx, N_X);
 
         // Qxx = Qxx + vectens(Vx(:,i+1),fxx(:,:,:,i));
 #if FULL_DDP
         for(j_= 0; j_<sizeofQxx; j_++) {// x, x
             d1= 0.0;
             for(i_= 0, k_= 0; i_<N_X; i_++, k_+= sizeofQxx) // f
-                d1+= Vx[i_]*t->fxx[j_+k_];
+                d1+= Vx[i_]*d->fxx[j_+k_];
             Qxx[j_]+= d1;
         }
 #endif
@@ -139,7 +155,7 @@ int back_pass(tOptSet *o) {
                 for(i_= 0; i_<=j_; i_++) {
                     d1= 0.0;
                     for(k_= 0; k_<N_U; k_++)
-                        d1+= t->fu[SYMTRI_MAT_IDX(k_, i_)]*t->fu[SYMTRI_MAT_IDX(k_, j_)];
+                        d1+= d->fu[SYMTRI_MAT_IDX(k_, i_)]*d->fu[SYMTRI_MAT_IDX(k_, j_)];
 
                     QuuF[UTRI_MAT_IDX(i_, j_)]+= d1*o->lambda;
                 }
@@ -148,7 +164,7 @@ int back_pass(tOptSet *o) {
                 for(j_= 0; j_<N_U; j_++) {
                     d1= 0.0;
                     for(k_= 0; k_<N_X; k_++)
-                        d1+= t->fx[MAT_IDX(k_, i_, N_X)]*t->fu[MAT_IDX(k_, j_, N_U)];
+                        d1+= d->fx[MAT_IDX(k_, i_, N_X)]*d->fu[MAT_IDX(k_, j_, N_U)];
 
                     Qxu_reg[MAT_IDX(i_, j_, N_X)]+= d1*o->lambda;
                 }
@@ -165,7 +181,12 @@ int back_pass(tOptSet *o) {
         else
             memcpy(t->l, (t+1)->l, sizeof(double)*N_U);
 
-        if((qpRes= boxQP(QuuF, Qu, t->lower, t->upper, t->l, R, L, grad, grad_clamped, search, is_clamped, &m_free, invHfree, N_U))<1) {
+        // closed form for two inputs, iterative solver if QuuF is not positive
+        // definite; same minimum and clamps as boxQP up to rounding, see
+        // test/test_boxqp.cpp
+        if(N_U!=2 || !(qpRes= boxQP_2(QuuF, Qu, d->lower, d->upper, t->l, is_clamped, &m_free, invHfree)))
+            qpRes= boxQP(QuuF, Qu, d->lower, d->upper, t->l, R, L, grad, grad_clamped, search, is_clamped, &m_free, invHfree, N_U);
+        if(qpRes<1) {
             TRACE(("@k= %d: qpRes= %d \n", k, qpRes));
             return 1;
         }
@@ -190,13 +211,13 @@ int back_pass(tOptSet *o) {
                             }
                         }
                         for(l_= 0; l_<N_X; l_++)
-                            t->L[MAT_IDX(i_, l_, N_U)]-= d1*((is_clamped[j_]==1)? t->lower_sign[j_]*t->lower_hx[MAT_IDX(l_, j_, N_X)]: t->upper_sign[j_]*t->upper_hx[MAT_IDX(l_, j_, N_X)]);
+                            t->L[MAT_IDX(i_, l_, N_U)]-= d1*((is_clamped[j_]==1)? d->lower_sign[j_]*d->lower_hx[MAT_IDX(l_, j_, N_X)]: d->upper_sign[j_]*d->upper_hx[MAT_IDX(l_, j_, N_X)]);
                     }
                 }
                 i_free++;
             } else {
                 for(l_= 0; l_<N_X; l_++)
-                    t->L[MAT_IDX(i_, l_, N_U)]-= (is_clamped[i_]==1)? t->lower_sign[i_]*t->lower_hx[MAT_IDX(l_, i_, N_X)]: t->upper_sign[i_]*t->upper_hx[MAT_IDX(l_, i_, N_X)];
+                    t->L[MAT_IDX(i_, l_, N_U)]-= (is_clamped[i_]==1)? d->lower_sign[i_]*d->lower_hx[MAT_IDX(l_, i_, N_X)]: d->upper_sign[i_]*d->upper_hx[MAT_IDX(l_, i_, N_X)];
             }
         }
         
@@ -231,14 +252,14 @@ int back_pass(tOptSet *o) {
         // Vxx(:,:,i)  = Qxx + K_i'*Quu*K_i + K_i'*Qux + Qux'*K_i;
         memcpy(Vxx, Qxx, sizeof(double)*sizeofQxx);
         addSquareTri(Vxx, Quu, t->L, N_U, N_X, dummy);
-        for(i_= 0; i_<N_X; i_++)
-            for(j_= 0; j_<N_X; j_++)
-                for(k_= 0; k_<N_U; k_++) {
-                    d1= t->L[MAT_IDX(k_, i_, N_U)]*Qxu[MAT_IDX(j_, k_, N_X)];
-                    if(i_==j_) d1*= 2.0;
-                    
-                    Vxx[SYMTRI_MAT_IDX(i_, j_)]+= d1;
-                }
+        for(j_= 0; j_<N_X; j_++)
+            for(i_= 0; i_<=j_; i_++) {
+                d1= 0.0;
+                for(k_= 0; k_<N_U; k_++)
+                    d1+= t->L[MAT_IDX(k_, i_, N_U)]*Qxu[MAT_IDX(j_, k_, N_X)] + t->L[MAT_IDX(k_, j_, N_U)]*Qxu[MAT_IDX(i_, k_, N_X)];
+
+                Vxx[UTRI_MAT_IDX(i_, j_)]+= d1;
+            }
         
 
 //         TRACE(("g_norm=\n"));
@@ -236,3 +236,69 @@ int boxQP(double *H, const double *g, const double *lower, const double *upper,
     
     return 1;
 }
+
+// Closed form box QP for two inputs. For positive definite H the minimum is
+// either the unconstrained one or lies on one of the four box edges, where it
+// is a clamped 1D minimum. Fills x, is_clamped, n_free_ and invHfree like
+// boxQP; returns 0 without touching them if H is not positive definite.
+int boxQP_2(const double *H, const double *g, const double *lower, const double *upper, double *x, int *is_clamped, int *n_free_, double *invHfree) {
+    const double h00= H[UTRI_MAT_IDX(0, 0)], h01= H[UTRI_MAT_IDX(0, 1)], h11= H[UTRI_MAT_IDX(1, 1)];
+    const double det= h00*h11 - h01*h01;
+    double xc[2], grad[2], hjj, value, vc;
+    int i, j, side, n_free;
+
+    if(h00<=0.0 || det<=0.0)
+        return 0;
+
+    // unconstrained minimum x= -H\g
+    x[0]= (h01*g[1] - h11*g[0])/det;
+    x[1]= (h01*g[0] - h00*g[1])/det;
+
+    if(x[0]<lower[0] || x[0]>upper[0] || x[1]<lower[1] || x[1]>upper[1]) {
+        value= INF;
+        for(i= 0; i<2; i++) { // input fixed at a bound
+            j= 1-i;
+            hjj= (j==0)? h00: h11;
+            for(side= 0; side<2; side++) {
+                xc[i]= side? upper[i]: lower[i];
+                xc[j]= -(g[j] + h01*xc[i])/hjj;
+                if(xc[j]>upper[j]) xc[j]= upper[j];
+                if(xc[j]<lower[j]) xc[j]= lower[j];
+
+                vc= xc[0]*(g[0] + 0.5*h00*xc[0] + h01*xc[1]) + xc[1]*(g[1] + 0.5*h11*xc[1]);
+                if(vc<value) {
+                    value= vc;
+                    x[0]= xc[0];
+                    x[1]= xc[1];
+                }
+            }
+        }
+    }
+
+    grad[0]= g[0] + h00*x[0] + h01*x[1];
+    grad[1]= g[1] + h01*x[0] + h11*x[1];
+    n_free= 0;
+    for(i= 0; i<2; i++) {
+        if(x[i]<=lower[i] && grad[i]>0)
+            is_clamped[i]= 1;
+        else if(x[i]>=upper[i] && grad[i]<0)
+            is_clamped[i]= 2;
+        else {
+            is_clamped[i]= 0;
+            n_free++;
+        }
+    }
+    n_free_[0]= n_free;
+
+    // inverse of H(free,free)
+    if(n_free==2) {
+        invHfree[UTRI_MAT_IDX(0, 0)]= h11/det;
+        invHfree[UTRI_MAT_IDX(0, 1)]= -h01/det;
+        invHfree[UTRI_MAT_IDX(1, 1)]= h00/det;
+    } else if(n_free==1)
+        invHfree[0]= 1.0/(is_clamped[0]? h11: h00);
+    else
+        return 6;
+
+    return 5;
+}
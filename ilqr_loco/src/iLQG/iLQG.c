@@ -11,6 +11,7 @@
 #include <string.h>
 #include <math.h>
 #include <stdlib.h>
+#include <time.h>
 
 //#include "mex.h"
 #ifndef  HAVE_OCTAVE
@@ -32,13 +33,16 @@
 
 #define TRACE(x) do { if (DEBUG_ILQG) PRNT x; } while (0)
 
-#if MULTI_THREADED
-pthread_mutex_t step_mutex= PTHREAD_MUTEX_INITIALIZER;
-pthread_cond_t  next_step_condition= PTHREAD_COND_INITIALIZER;
-int step_calc_done;
-int derivs_result;
-int bp_result;
-#endif
+// time stamps for o->stats, not taken when nothing is recorded
+#define STATS_TIME(o) (((o)->stats!=NULL)? monotonic_time(): 0.0)
+
+// seconds on a clock that is not affected by system time changes
+double monotonic_time() {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + 1e-9*ts.tv_nsec;
+}
 
 void printParams(double **p, int k) {
     int i;
@@ -52,14 +56,10 @@ void printParams(double **p, int k) {
     }
 }
 
-void standard_parameters(tOptSet *o) {
-    // TODO why didn't the first way work??
-    double* pointer;
-    pointer = malloc(8*sizeof(double));
-    double default_alpha[]= {1.0, 0.3727594, 0.1389495, 0.0517947, 0.0193070, 0.0071969, 0.0026827, 0.0010000};
-    memcpy(pointer, default_alpha, 8*sizeof(double));
+static const double default_alpha[]= {1.0, 0.3727594, 0.1389495, 0.0517947, 0.0193070, 0.0071969, 0.0026827, 0.0010000};
 
-    o->alpha= pointer;
+void standard_parameters(tOptSet *o) {
+    o->alpha= default_alpha;
     o->n_alpha= 8;
     // o->tolFun= 1e-7;
     // o->tolConstraint= 1e-7;
@@ -219,16 +219,25 @@ char *setOptParam(tOptSet *o, const char *name, const double *value, const int n
     return NULL;
 }
 
-
-#if MULTI_THREADED
-void *derivs_thread_function(void *o);
-void *bp_thread_function(void *o);
-#endif
+// why iLQG() left its main loop
+enum {
+    EXIT_MAX_ITER,
+    EXIT_TOL_FUN,
+    EXIT_TOL_GRAD,
+    EXIT_LAMBDA_MAX,
+    EXIT_NO_DESCENT,
+    EXIT_DERIVS_FAILED,
+    EXIT_DEADLINE,
+    EXIT_CANCELLED
+};
 
 int iLQG(tOptSet *o) {
-    int iter, diverge, backPassDone, fwdPassDone;
+    int iter, diverge, backPassDone= 0, fwdPassDone, bpRes, exitReason= EXIT_MAX_ITER;
     int newDeriv;
     double dlambda= o->dlambdaInit;
+    double t_iter, t_derivs, t_back_pass, t_wait, t_line_search;
+    solveStats_t *st= o->stats;
+    iterStats_t *rec;
 
     o->lambda= o->lambdaInit;
     o->w_pen_l= o->w_pen_init_l;
@@ -237,12 +246,35 @@ int iLQG(tOptSet *o) {
 
     update_multipliers(o, 1);
 
+    if(st!=NULL) {
+        st->n_iter= 0;
+        st->t_derivs= st->t_back_pass= st->t_line_search= 0.0;
+    }
+
     for(iter= 0; iter < o->max_iter; iter++) {
+        // the nominal trajectory is always the best accepted one, so it can
+        // be handed out as it is once the time is up
+        if(o->deadline>0.0 && monotonic_time()>=o->deadline) {
+            if(o->debug_level>=1)
+                TRACE(("\nEXIT: deadline reached.\n"));
+            exitReason= EXIT_DEADLINE;
+            break;
+        }
+        if(o->stop_check!=NULL && o->stop_check(o, o->stop_arg)) {
+            if(o->debug_level>=1)
+                TRACE(("\nEXIT: cancelled.\n"));
+            exitReason= EXIT_CANCELLED;
+            break;
+        }
+
+        t_iter= STATS_TIME(o);
+
         // ====== STEP 1: differentiate dynamics and cost along new trajectory: integrated in back_pass
         if(newDeriv) {
 
             if(!calc_derivs(o)) {
                 TRACE(("Calculating derivatives failed.\n"));
+                exitReason= EXIT_DERIVS_FAILED;
                 break;
             } else {
 //                 TRACE(("\n"));
@@ -251,11 +283,15 @@ int iLQG(tOptSet *o) {
             newDeriv= 0;
         }
 
+        t_derivs= STATS_TIME(o);
+
         // ====== STEP 2: backward pass, compute optimal control law and cost-to-go
         backPassDone= 0;
 //         TRACE(("Back pass:\n"));
         while(!backPassDone) {
-            if(back_pass(o)) {
+            if((bpRes= back_pass(o))==2) {
+                break;
+            } else if(bpRes) {
                 if(o->debug_level>=1)
                     TRACE(("Back pass failed.\n"));
 
@@ -268,6 +304,19 @@ int iLQG(tOptSet *o) {
 //                 TRACE(("...done\n"));
             }
         }
+        t_back_pass= STATS_TIME(o);
+        wait_derivs(o);
+        t_wait= STATS_TIME(o);
+        if(st!=NULL) {
+            st->t_derivs+= (t_derivs - t_iter) + (t_wait - t_back_pass);
+            st->t_back_pass+= t_back_pass - t_derivs;
+        }
+
+        if(bpRes==2) {
+            TRACE(("Calculating derivatives failed.\n"));
+            exitReason= EXIT_DERIVS_FAILED;
+            break;
+        }
 
         // check for termination due to small gradient
         // TODO: add constraint tolerance check
@@ -276,14 +325,35 @@ int iLQG(tOptSet *o) {
             o->lambda= o->lambda * dlambda * (o->lambda > o->lambdaMin);
             if(o->debug_level>=1)
                 TRACE(("\nSUCCESS: gradient norm < tolGrad\n"));
+            exitReason= EXIT_TOL_GRAD;
             break;
         }
 
         // ====== STEP 3: line-search to find new control sequence, trajectory, cost
-        if(backPassDone)
+        if(backPassDone) {
             fwdPassDone= line_search(o, iter);
-        else
+        } else {
+            if(o->debug_level>=1)
+                TRACE(("\nEXIT: no descent direction found.\n"));
+            exitReason= EXIT_NO_DESCENT;
             break;
+        }
+
+        if(st!=NULL) {
+            t_line_search= monotonic_time();
+            st->t_line_search+= t_line_search - t_wait;
+            if(iter<st->max_iter) {
+                rec= &st->iter[iter];
+                rec->cost= fwdPassDone? o->new_cost: o->cost;
+                rec->dcost= o->dcost;
+                rec->lambda= o->lambda;
+                rec->g_norm= o->g_norm;
+                rec->t_derivs= (t_derivs - t_iter) + (t_wait - t_back_pass);
+                rec->t_back_pass= t_back_pass - t_derivs;
+                rec->t_line_search= t_line_search - t_wait;
+                st->n_iter= iter+1;
+            }
+        }
 
         // ====== STEP 4: accept (or not), draw graphics
         if(fwdPassDone) {
@@ -306,7 +376,7 @@ int iLQG(tOptSet *o) {
             if(o->dcost < o->tolFun) {
                 if(o->debug_level>=1)
                     TRACE(("\nSUCCESS: cost change < tolFun\n"));
-
+                exitReason= EXIT_TOL_FUN;
                 break;
             }
             // adapt w_pen
@@ -333,6 +403,7 @@ int iLQG(tOptSet *o) {
             if(o->lambda > o->lambdaMax) {
                 if(o->debug_level>=1)
                     TRACE(("\nEXIT: lambda > lambdaMax\n"));
+                exitReason= EXIT_LAMBDA_MAX;
                 break;
             }
         }
@@ -341,18 +412,21 @@ int iLQG(tOptSet *o) {
 
     o->iterations= iter;
 
-    if(!backPassDone) {
-        if(o->debug_level>=1)
-            TRACE(("\nEXIT: no descent direction found.\n"));
-
-        return 0;
-    } else if(iter>=o->max_iter) {
+    switch(exitReason) {
+    case EXIT_TOL_FUN:
+    case EXIT_TOL_GRAD:
+        return ILQG_CONVERGED;
+    case EXIT_DEADLINE:
+        return ILQG_DEADLINE;
+    case EXIT_CANCELLED:
+        return ILQG_CANCELLED;
+    case EXIT_MAX_ITER:
         if(o->debug_level>=1)
             TRACE(("\nEXIT: Maximum iterations reached.\n"));
-
-        return 0;
+        return ILQG_NOT_CONVERGED;
+    default: // EXIT_LAMBDA_MAX, EXIT_NO_DESCENT, EXIT_DERIVS_FAILED
+        return ILQG_NOT_CONVERGED;
     }
-    return 1;
 }
 
 void makeCandidateNominal(tOptSet *o, int idx) {
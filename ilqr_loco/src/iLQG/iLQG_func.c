@@ -1,7 +1,17 @@
-/* File generated form template iLQG_func.tem on 2017-03-25 10:51:16-04:00. Do not edit! */
+/* File generated form template iLQG_func.tem on 2017-03-25 10:51:16-04:00 and edited by hand
+ * since. Regenerating it drops the hand written parts, carry them over:
+ *   obstacle_cost, obstacle_derivs     any number of obstacles, culled per step
+ *   derivs_chunk, calc_derivs,         derivatives in chunks on the thread pool,
+ *   wait_derivs                        into o->derivs instead of the trajectory
+ *   limitsU, bp_derivsL, init_running  write derivEl_t, see trajEl_t in iLQG.h
+ *   ddpf_lanes, forward_pass_batch     line search rollouts in vector lanes
+ *   simulate_controls                  start state prediction of traj_client
+ */
 #include <stdio.h>
+#include <string.h>
 #include "iLQG.h"
 #include "matMult.h"
+#include "vec_math.h"
 
 #define mcond(cond, a, dummy, b) ((cond)? a: b)
 #define abs fabs
@@ -51,15 +61,103 @@ static int calcXUVariableAux(trajEl_t *t, multipliersEl_t *m, int k, tOptSet *o)
 static int calcFVariableAux(trajFin_t *t, multipliersFin_t *m, tOptSet *o);
 static int calcLAuxDeriv(trajEl_t *t, multipliersEl_t *m, int k, tOptSet *o);
 static int calcFAuxDeriv(trajFin_t *t, multipliersFin_t *m, tOptSet *o);
-static int bp_derivsL(trajEl_t *t, int k, double **p);
+static int bp_derivsL(const trajEl_t *t, derivEl_t *d, int k, double **p);
 static int bp_derivsF(trajFin_t *t, int k, double **p);
 
+// Obstacle terms of the running cost for a variable number of obstacles:
+// o->n_obs x, y pairs in p[3]. Obstacles farther than
+// max(d_thres, o->obs_cull_dist) from a state are skipped before anything
+// else is computed. The position term is zero beyond d_thres anyway, the
+// velocity term (k_vel) is cut off at that distance.
+static double obstacle_cost(const double *x, const tOptSet *o) {
+    double **p= o->p;
+    const double *obs= p[3];
+    double r_cull= max(p[14][0], o->obs_cull_dist);
+    double ex, ey, r2, d, g, s, c= 0.0;
+    int j;
+
+    for(j= 0; j<o->n_obs; j++) {
+        ex= x[0] - obs[2*j];
+        ey= x[1] - obs[2*j+1];
+        r2= 1.e-6 + ex*ex + ey*ey;
+        if(r2 > r_cull*r_cull)
+            continue;
+        d= sqrt(r2);
+
+        if(d <= p[14][0]) {
+            g= 1/d - 1/p[14][0];
+            c+= p[16][0]*g*g;
+        }
+        s= x[3]*ex + x[4]*ey;
+        if(p[17][0]!=0.0 && s>=0.0)
+            c+= p[17][0]*s/d/sqrt(1.e-6 + x[3]*x[3] + x[4]*x[4]);
+    }
+
+    return c;
+}
+
+// adds the derivatives of obstacle_cost to der->cx and der->cxx; they depend on
+// x[0], x[1] (e, offset from the obstacle) and x[3], x[4] (v, velocity)
+static void obstacle_derivs(const trajEl_t *t, derivEl_t *der, const tOptSet *o) {
+    static const int ie[2]= {0, 1}, iv[2]= {3, 4};
+    const double *x= t->x;
+    double **p= o->p;
+    const double *obs= p[3];
+    double r_cull= max(p[14][0], o->obs_cull_dist);
+    double e[2], v[2], r2, d, d3, g, s, a, b, V, V3;
+    double kp= p[16][0], kv= p[17][0];
+    int j, i, l;
+
+    v[0]= x[3];
+    v[1]= x[4];
+    V= sqrt(1.e-6 + v[0]*v[0] + v[1]*v[1]);
+    V3= V*V*V;
+
+    for(j= 0; j<o->n_obs; j++) {
+        e[0]= x[0] - obs[2*j];
+        e[1]= x[1] - obs[2*j+1];
+        r2= 1.e-6 + e[0]*e[0] + e[1]*e[1];
+        if(r2 > r_cull*r_cull)
+            continue;
+        d= sqrt(r2);
+        d3= d*r2;
+
+        // kp*g^2, g= 1/d - 1/d_thres
+        if(d <= p[14][0]) {
+            g= 1/d - 1/p[14][0];
+            for(i= 0; i<2; i++) {
+                der->cx[ie[i]]+= -2.0*kp*g*e[i]/d3;
+                for(l= 0; l<=i; l++)
+                    der->cxx[UTRI_MAT_IDX(ie[l], ie[i])]+= 2.0*kp*(e[l]*e[i]/(d3*d3) + g*(3.0*e[l]*e[i]/(d3*r2) - (l==i)/d3));
+            }
+        }
+
+        // kv*s*a*b, s= v.e, a= 1/d, b= 1/V
+        s= v[0]*e[0] + v[1]*e[1];
+        if(kv!=0.0 && s>=0.0) {
+            a= 1/d;
+            b= 1/V;
+            for(i= 0; i<2; i++) {
+                der->cx[ie[i]]+= kv*(v[i]*a*b - s*e[i]*b/d3);
+                der->cx[iv[i]]+= kv*(e[i]*a*b - s*a*v[i]/V3);
+                for(l= 0; l<=i; l++) {
+                    der->cxx[UTRI_MAT_IDX(ie[l], ie[i])]+= kv*b*(-(v[l]*e[i] + v[i]*e[l])/d3 - s*(l==i)/d3 + 3.0*s*e[l]*e[i]/(d3*r2));
+                    der->cxx[UTRI_MAT_IDX(iv[l], iv[i])]+= kv*a*(-(e[l]*v[i] + e[i]*v[l])/V3 - s*(l==i)/V3 + 3.0*s*v[l]*v[i]/(V3*V*V));
+                }
+                for(l= 0; l<2; l++)
+                    der->cxx[UTRI_MAT_IDX(ie[l], iv[i])]+= kv*((l==i)*a*b - v[l]*v[i]*a/V3 - e[l]*e[i]*b/d3 + s*e[l]*v[i]/(d3*V3));
+            }
+        }
+    }
+}
+
 static int ddpL(trajEl_t *t, int k, tOptSet *o) {
     const double *x= t->x;
     const double *u= t->u;
     double **p= o->p;
     
-    t->c=(-1.2+sqrt(1.0+pow(x[3],2.0)))*p[8][0]+pow(x[8],2.0)*p[9][0]+pow(x[9],2.0)*p[9][1]+pow(u[0],2.0)*p[12][0]+pow(u[1],2.0)*p[12][1]+p[13][0]*(-p[24][0]+sqrt(pow(p[24][0],2.0)+pow(x[0]-p[25][0],2.0)))+p[13][1]*(-p[24][1]+sqrt(pow(p[24][1],2.0)+pow(x[1]-p[25][1],2.0)))+p[13][2]*(-p[24][2]+sqrt(pow(p[24][2],2.0)+pow(x[2]-p[25][2],2.0)))+p[10][0]*(-p[24][0]+sqrt(pow(p[24][0],2.0)+pow(x[3]-p[25][3],2.0)))+p[10][1]*(-p[24][1]+sqrt(pow(p[24][1],2.0)+pow(x[4]-p[25][4],2.0)))+p[10][2]*(-p[24][2]+sqrt(pow(p[24][2],2.0)+pow(x[5]-p[25][5],2.0)))+p[16][0]*mcond(sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))>p[14][0],0.0,1,pow(1/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))-1/p[14][0],2.0))+p[17][0]*mcond(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4]<0.0,0.0,1,(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4])/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0)));
+    t->c=(-1.2+sqrt(1.0+pow(x[3],2.0)))*p[8][0]+pow(x[8],2.0)*p[9][0]+pow(x[9],2.0)*p[9][1]+pow(u[0],2.0)*p[12][0]+pow(u[1],2.0)*p[12][1]+p[13][0]*(-p[24][0]+sqrt(pow(p[24][0],2.0)+pow(x[0]-p[25][0],2.0)))+p[13][1]*(-p[24][1]+sqrt(pow(p[24][1],2.0)+pow(x[1]-p[25][1],2.0)))+p[13][2]*(-p[24][2]+sqrt(pow(p[24][2],2.0)+pow(x[2]-p[25][2],2.0)))+p[10][0]*(-p[24][0]+sqrt(pow(p[24][0],2.0)+pow(x[3]-p[25][3],2.0)))+p[10][1]*(-p[24][1]+sqrt(pow(p[24][1],2.0)+pow(x[4]-p[25][4],2.0)))+p[10][2]*(-p[24][2]+sqrt(pow(p[24][2],2.0)+pow(x[5]-p[25][5],2.0)));
+    t->c+= obstacle_cost(x, o);
     if (isNANorINF(t->c))
         {
             PRNT("    @k %d: t->c in line %d is nan or inf: %g\n", k, __LINE__-3,t->c);
@@ -94,10 +192,6 @@ static int ddpL(trajEl_t *t, int k, tOptSet *o) {
                 PRNT("        p[13,1]= %g\n",p[13][1]);
                 PRNT("        p[25,1]= %g\n",p[25][1]);
                 PRNT("        x[1]= %g\n",x[1]);
-                PRNT("        p[17,0]= %g\n",p[17][0]);
-                PRNT("        p[3,0]= %g\n",p[3][0]);
-                PRNT("        p[3,1]= %g\n",p[3][1]);
-                PRNT("        p[16,0]= %g\n",p[16][0]);
                 PRNT("        p[14,0]= %g\n",p[14][0]);
             }
             return(0);
@@ -408,7 +502,7 @@ void clampU(double *u, trajEl_t *t, int k, double **p, int N) {
 
 }
 
-static void limitsU(trajEl_t *t, int k, double **p, int N) {
+static void limitsU(const trajEl_t *t, derivEl_t *d, int k, double **p, int N) {
     int i, j;
     int lower_idx[N_U], upper_idx[N_U], *idx_;
     double limit;
@@ -418,57 +512,57 @@ static void limitsU(trajEl_t *t, int k, double **p, int N) {
     for(i= 0; i<N_U; i++) {
         lower_idx[i]= -1;
         upper_idx[i]= -1;
-        t->lower[i]= -INF;
-        t->upper[i]= INF;
+        d->lower[i]= -INF;
+        d->upper[i]= INF;
     }        
     
 // constraint h[1]= limThr[0]-thr
     limit=p[19][0];
-    if (t->lower[0]<limit)
+    if (d->lower[0]<limit)
         {
-            t->lower[0]=limit;
+            d->lower[0]=limit;
             lower_idx[0]=0;
         }
 
 // constraint h[2]= -limThr[1]+thr
     limit=p[19][1];
-    if (t->upper[0]>limit)
+    if (d->upper[0]>limit)
         {
-            t->upper[0]=limit;
+            d->upper[0]=limit;
             upper_idx[0]=1;
         }
 
 // constraint h[3]= limSteer[0]-steer
     limit=p[18][0];
-    if (t->lower[1]<limit)
+    if (d->lower[1]<limit)
         {
-            t->lower[1]=limit;
+            d->lower[1]=limit;
             lower_idx[1]=2;
         }
 
 // constraint h[4]= -limSteer[1]+steer
     limit=p[18][1];
-    if (t->upper[1]>limit)
+    if (d->upper[1]>limit)
         {
-            t->upper[1]=limit;
+            d->upper[1]=limit;
             upper_idx[1]=3;
         }
 
 
     for(i= 0; i<N_U; i++) {
-        t->lower[i]-= t->u[i];
-        t->upper[i]-= t->u[i]; 
+        d->lower[i]-= t->u[i];
+        d->upper[i]-= t->u[i]; 
     }
 
     for(j= 0; j<2; j++) {
         if(j==0) {
             idx_= lower_idx;
-            hx_= t->lower_hx;
-            h_sign= t->lower_sign;
+            hx_= d->lower_hx;
+            h_sign= d->lower_sign;
         } else {
             idx_= upper_idx;
-            hx_= t->upper_hx;
-            h_sign= t->upper_sign;
+            hx_= d->upper_hx;
+            h_sign= d->upper_sign;
         }
         for(i= 0; i<N_U; i++, hx_+= N_X, h_sign++) {
             switch(idx_[i]) {
@@ -602,42 +696,316 @@ int forward_pass(traj_t *c, tOptSet *o, double alpha, double *csum, int cost_onl
     return 1;
 }
 
+// Integrates the car model from x0 over n commands, command i is
+// u[i*N_U .. i*N_U+N_U-1] and held for dt[i] seconds. Returns 0 if the state
+// became nan or inf. p[15] (h) is swapped for each step and restored.
+int simulate_controls(double x_end[], const double x0[], const double *u, const double *dt, int n, double **p) {
+    trajEl_t t;
+    double h, *h_saved;
+    int i, k, ok= 1;
+
+    memcpy(t.x, x0, N_X*sizeof(double));
+    memcpy(x_end, x0, N_X*sizeof(double));
+
+    h_saved= p[15];
+    p[15]= &h;
+    for(k= 0; k<n && ok; k++) {
+        h= dt[k];
+        for(i= 0; i<N_U; i++)
+            t.u[i]= u[k*N_U+i];
+        ok= ddpf(x_end, &t, k, p, n);
+        memcpy(t.x, x_end, N_X*sizeof(double));
+    }
+    p[15]= h_saved;
+
+    return ok;
+}
+
+#if ILQG_FLOAT
+#define R_FABS fabsf
+#define R_SQRT sqrtf
+#define R_SINCOS sincos_lanef
+#else
+#define R_FABS fabs
+#define R_SQRT sqrt
+#define R_SINCOS sincos_lane
+#endif
+// literal in the precision of the rollout lanes
+#define RL(c) ((roll_t) (c))
+
+// ddpf for ROLLOUT_LANES states at once, x[i][l] is state i of lane l.
+// tan(atan(z))= z for the rear slip angle, and the front one is recovered
+// from tan(atan(zF) -+ steer) by the addition theorem; wrapping alpha_F to
+// +-pi/2 only flips the sign of its tangent. Together with the heading
+// rotation in sines and cosines this leaves no atan or tan, so the lane loop
+// is branch free and vectorizes. ok[l]= 0 where ddpf would report inf or nan.
+// The lanes compute in roll_t, see ILQG_FLOAT.
+static void ddpf_lanes(roll_t x_next[N_X][ROLLOUT_LANES], roll_t x[N_X][ROLLOUT_LANES], roll_t u[N_U][ROLLOUT_LANES], double **p, int ok[ROLLOUT_LANES]) {
+    const roll_t G_f= p[0][0], G_r= p[1][0], Iz= p[2][0], a= p[4][0], b= p[5][0];
+    const roll_t c_a= p[6][0], c_x= p[7][0], h= p[15][0], m= p[20][0], mu= p[21][0], mu_s= p[22][0];
+    const roll_t Ff_1= (1.0/(3.0*mu*G_f))*(2.0-mu_s/mu), Ff_2= (1.0/(9.0*mu*mu*G_f*G_f))*(1.0-(2.0/3.0)*(mu_s/mu));
+    const roll_t Fr_1= (1.0/(3.0*mu*G_r))*(2.0-mu_s/mu), Fr_2= (1.0/(9.0*mu*mu*G_r*G_r))*(1.0-(2.0/3.0)*(mu_s/mu));
+    roll_t Ux, Uy, r, thr, steer, den, zF, zR, s_st, c_st, tan_st, tanF, K, reverse, kk, tanR;
+    roll_t gamma_F, gamma_R, Ff, Ff_sat, Fr, Fr_sat, Fyf, Fxr, Fyr, dr, dUx, dUy;
+    roll_t V, zb, cb, sb, s_phi, c_phi, flip;
+    int l, i;
+
+    for(l= 0; l<ROLLOUT_LANES; l++) {
+        Ux= x[3][l];
+        Uy= x[4][l];
+        r= x[5][l];
+        thr= u[0][l];
+        steer= u[1][l];
+
+        den= R_FABS(Ux)+RL(1e-3);
+        zF= (Uy+a*r)/den;
+        zR= (Uy-b*r)/den;
+
+        R_SINCOS(steer, &s_st, &c_st);
+        tan_st= s_st/c_st;
+        tan_st= (Ux>=RL(0.0))? -tan_st: tan_st;
+        tanF= (zF + tan_st)/R_FABS(RL(1.0) - zF*tan_st);
+
+        K= (thr-Ux)/den;
+        reverse= (K<RL(0.0))? -RL(1.0): RL(1.0);
+        K= R_FABS(K);
+        kk= K/(RL(1.0)+K);
+        tanR= zR/(RL(1.0)+K);
+
+        gamma_F= R_FABS(c_a*tanF);
+        gamma_R= R_SQRT(c_x*c_x*kk*kk + c_a*c_a*tanR*tanR);
+        // both branches are computed so the selection needs no jump
+        Ff= RL(1.0) - Ff_1*gamma_F + Ff_2*gamma_F*gamma_F;
+        Ff_sat= mu_s*G_f/gamma_F;
+        Ff= (gamma_F <= RL(3.0)*mu*G_f)? Ff: Ff_sat;
+        Fr= RL(1.0) - Fr_1*gamma_R + Fr_2*gamma_R*gamma_R;
+        Fr_sat= mu_s*G_r/gamma_R;
+        Fr= (gamma_R <= RL(3.0)*mu*G_r)? Fr: Fr_sat;
+
+        Fyf= -c_a*tanF*Ff;
+        Fxr= c_x*kk*Fr*reverse;
+        Fyr= -c_a*tanR*Fr;
+
+        dr= (a*Fyf*c_st-b*Fyr)/Iz;
+        dUx= (Fxr-Fyf*s_st)/m+r*Uy;
+        dUy= (Fyf*c_st+Fyr)/m-r*Ux;
+
+        // heading phi+atan(zb), or phi-atan(zb)+-pi when reversing with side slip
+        V= R_SQRT(RL(1.e-6)+Ux*Ux+Uy*Uy)*h;
+        zb= Uy/(RL(0.001)+R_FABS(Ux));
+        cb= RL(1.0)/R_SQRT(RL(1.0)+zb*zb);
+        flip= ((Ux<RL(0.0)) & (Uy!=RL(0.0)))? -RL(1.0): RL(1.0);
+        sb= flip*zb*cb;
+        R_SINCOS(x[2][l], &s_phi, &c_phi);
+
+        x_next[0][l]= x[0][l] + V*flip*(c_phi*cb - s_phi*sb);
+        x_next[1][l]= x[1][l] + V*flip*(s_phi*cb + c_phi*sb);
+        x_next[2][l]= x[2][l] + r*h;
+        x_next[3][l]= Ux + h*dUx;
+        x_next[4][l]= Uy + h*dUy;
+        x_next[5][l]= r + h*dr;
+        x_next[6][l]= thr;
+        x_next[7][l]= steer;
+        x_next[8][l]= thr - x[6][l];
+        x_next[9][l]= steer - x[7][l];
+    }
+
+    for(l= 0; l<ROLLOUT_LANES; l++) {
+        ok[l]= 1;
+        for(i= 0; i<N_X; i++)
+            if(isNANorINF(x_next[i][l])) ok[l]= 0;
+    }
+}
+
+// Rolls out the n<=ROLLOUT_LANES candidates c[l] with step alpha[l] side by
+// side, the dynamics of all lanes in one ddpf_lanes call per time step. Per
+// lane the result equals forward_pass(c[l], o, alpha[l], &csum[l], 0) up to
+// rounding; success[l]= 0 where that would have failed.
+void forward_pass_batch(traj_t **c, tOptSet *o, const double *alpha, int n, double *csum, int *success) {
+    int i, k, j, l;
+    double dx;
+    double *x0= o->x0;
+    int N= o->n_hor;
+    double **params= o->p;
+
+    trajEl_t *t= o->nominal->t;
+    trajEl_t *ct;
+    trajFin_t *cf;
+
+    multipliersEl_t *m= o->multipliers.t;
+    multipliersFin_t *mf= &o->multipliers.f;
+
+    roll_t xl[N_X][ROLLOUT_LANES], ul[N_U][ROLLOUT_LANES], xl_next[N_X][ROLLOUT_LANES];
+    int ok[ROLLOUT_LANES];
+    double *x_next;
+
+    // idle lanes compute on zeros and are ignored
+    memset(xl, 0, sizeof(xl));
+    memset(ul, 0, sizeof(ul));
+
+    for(l= 0; l<n; l++) {
+        csum[l]= 0.0;
+        success[l]= 1;
+        for(i= 0; i<N_X; i++) c[l]->t->x[i]= x0[i]; // ic
+    }
+
+    for(k= 0; k<N; k++, t++, m++) {
+        for(l= 0; l<n; l++) {
+            if(!success[l])
+                continue;
+            ct= c[l]->t + k;
+
+            if(alpha[l]) {
+                for(j= 0; j<N_U; j++)
+                    ct->u[j]= t->u[j] + t->l[j]*alpha[l];
+                for(i= 0; i<N_X; i++) {
+                    dx= ct->x[i] - t->x[i];
+
+                    for(j= 0; j<N_U; j++) {
+                        ct->u[j]+= t->L[MAT_IDX(j, i, N_U)]*dx;
+                    }
+                }
+            } else {
+                for(j= 0; j<N_U; j++)
+                    ct->u[j]= t->u[j];
+            }
+            if(!calcXVariableAux(ct, m, k, o)) {
+                success[l]= 0;
+                continue;
+            }
+            clampU(ct->u, ct, k, params, N);
+            if(!calcXUVariableAux(ct, m, k, o)) {
+                success[l]= 0;
+                continue;
+            }
+
+            for(i= 0; i<N_X; i++) xl[i][l]= ct->x[i];
+            for(j= 0; j<N_U; j++) ul[j][l]= ct->u[j];
+        }
+
+        ddpf_lanes(xl_next, xl, ul, params, ok);
+
+        for(l= 0; l<n; l++) {
+            if(!success[l])
+                continue;
+            ct= c[l]->t + k;
+
+            if(k>=N-1)
+                x_next= c[l]->f.x;
+            else
+                x_next= (ct+1)->x;
+            for(i= 0; i<N_X; i++) x_next[i]= xl_next[i][l];
+            if(!ok[l] || !ddpL(ct, k, o)) {
+                success[l]= 0;
+                continue;
+            }
+            csum[l]+= ct->c;
+        }
+    }
+
+    for(l= 0; l<n; l++) {
+        if(!success[l])
+            continue;
+        cf= &c[l]->f;
+        if(!calcFVariableAux(cf, mf, o) || !ddpF(cf, o)) {
+            success[l]= 0;
+            continue;
+        }
+        csum[l]+= cf->c;
+    }
+}
+
+#if MULTI_THREADED
+// derivatives of time steps k_last down to k_last-DERIVS_CHUNK+1 with
+// k_last= N-1-idx*DERIVS_CHUNK, so chunk 0 is the end of the horizon
+static void derivs_chunk(void *arg, int idx) {
+    tOptSet *o= (tOptSet *) arg;
+    int k, k_first, k_last, success= 1;
+    int N= o->n_hor;
+    int n_chunks= (N + DERIVS_CHUNK - 1)/DERIVS_CHUNK;
+
+    k_last= N - 1 - idx*DERIVS_CHUNK;
+    k_first= (k_last - DERIVS_CHUNK + 1 > 0)? k_last - DERIVS_CHUNK + 1: 0;
+
+    trajEl_t *t= o->nominal->t + k_last;
+    derivEl_t *d= o->derivs + k_last;
+    multipliersEl_t *m= o->multipliers.t + k_last;
+
+    for(k= k_last; k>=k_first; k--, t--, d--, m--) {
+        if(!calcLAuxDeriv(t, m, k, o) || !bp_derivsL(t, d, k, o->p)) {
+            success= 0;
+            break;
+        }
+        obstacle_derivs(t, d, o);
+        
+        limitsU(t, d, k, o->p, N);
+    }
+
+    // chunks finish out of order; step_calc_done only advances over an
+    // unbroken run of finished chunks from the end of the horizon
+    pthread_mutex_lock(&o->step_mutex);
+    if(!success) {
+        o->step_calc_done= -1;
+    } else {
+        o->chunk_done[idx]= 1;
+        while(o->n_chunks_ready<n_chunks && o->chunk_done[o->n_chunks_ready]) {
+            o->n_chunks_ready++;
+            if(o->step_calc_done>=0)
+                o->step_calc_done= (N - o->n_chunks_ready*DERIVS_CHUNK > 0)? N - o->n_chunks_ready*DERIVS_CHUNK: 0;
+        }
+    }
+    pthread_cond_broadcast(&o->next_step_condition);
+    pthread_mutex_unlock(&o->step_mutex);
+}
+#endif
+
+// With MULTI_THREADED the running derivatives are only started here and
+// computed on o->pool; back_pass consumes them as they become ready and
+// wait_derivs has to be called before the nominal trajectory changes.
 int calc_derivs(tOptSet *o) {
-    int k, i_;
     int N= o->n_hor;
 
-    trajEl_t *t= o->nominal->t + N -1;
     trajFin_t *f= &o->nominal->f;
-    
-    multipliersEl_t *m= o->multipliers.t + N - 1;
     multipliersFin_t *mf= &o->multipliers.f;
+#if !MULTI_THREADED
+    int k;
+    trajEl_t *t= o->nominal->t + N -1;
+    derivEl_t *d= o->derivs + N - 1;
+    multipliersEl_t *m= o->multipliers.t + N - 1;
+#endif
 
     if(!calcFAuxDeriv(f, mf, o)) return 0;
     if(!bp_derivsF(f, N, o->p)) return 0;
     
 #if MULTI_THREADED   
-    pthread_mutex_lock(&step_mutex);
-    step_calc_done= N;
-    pthread_cond_signal(&next_step_condition);
-    pthread_mutex_unlock(&step_mutex);
-#endif
+    int n_chunks= (N + DERIVS_CHUNK - 1)/DERIVS_CHUNK;
+
+    pthread_mutex_lock(&o->step_mutex);
+    memset(o->chunk_done, 0, sizeof(int)*n_chunks);
+    o->n_chunks_ready= 0;
+    o->step_calc_done= N;
+    pthread_cond_broadcast(&o->next_step_condition);
+    pthread_mutex_unlock(&o->step_mutex);
 
-    for(k= N-1; k>=0; k--, t--, m--) {
+    thread_pool_start(o->pool, derivs_chunk, o, n_chunks);
+#else
+    for(k= N-1; k>=0; k--, t--, d--, m--) {
         if(!calcLAuxDeriv(t, m, k, o)) return 0;
-        if(!bp_derivsL(t, k, o->p)) return 0;
+        if(!bp_derivsL(t, d, k, o->p)) return 0;
+        obstacle_derivs(t, d, o);
         
-        limitsU(t, k, o->p, N);
-
-#if MULTI_THREADED   
-        pthread_mutex_lock(&step_mutex);
-        step_calc_done= k;
-        pthread_cond_signal(&next_step_condition);
-        pthread_mutex_unlock(&step_mutex);
-#endif
+        limitsU(t, d, k, o->p, N);
     }
+#endif
     return 1;
 }
 
+void wait_derivs(tOptSet *o) {
+#if MULTI_THREADED
+    thread_pool_wait(o->pool);
+#endif
+}
+
 static int calcXVariableAux(trajEl_t *t, multipliersEl_t *m, int k, tOptSet *o) {
     const double *x= t->x;
     double **p= o->p;
@@ -673,7 +1041,7 @@ static int calcLAuxDeriv(trajEl_t *t, multipliersEl_t *m, int k, tOptSet *o) {
     return 1;
 }
 
-static int bp_derivsL(trajEl_t *t, int k, double **p) {
+static int bp_derivsL(const trajEl_t *t, derivEl_t *d, int k, double **p) {
     const double *x= t->x;
     const double *u= t->u;
     
@@ -681,10 +1049,10 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
 // df[i]/d x[0]
 // df[i]/d x[1]
 // df[i]/d x[2]
-    t->fx[20]=-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))));
-    if (isNANorINF(t->fx[20]))
+    d->fx[20]=-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))));
+    if (isNANorINF(d->fx[20]))
         {
-            PRNT("    @k %d: t->fx[20] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fx[20]);
+            PRNT("    @k %d: d->fx[20] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fx[20]);
             {
                 PRNT("        x[3]= %g\n",x[3]);
                 PRNT("        x[4]= %g\n",x[4]);
@@ -693,10 +1061,10 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fx[21]=sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))));
-    if (isNANorINF(t->fx[21]))
+    d->fx[21]=sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))));
+    if (isNANorINF(d->fx[21]))
         {
-            PRNT("    @k %d: t->fx[21] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fx[21]);
+            PRNT("    @k %d: d->fx[21] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fx[21]);
             {
                 PRNT("        x[3]= %g\n",x[3]);
                 PRNT("        x[4]= %g\n",x[4]);
@@ -706,10 +1074,10 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             return(0);
         }
 // df[i]/d x[3]
-    t->fx[30]=x[3]*p[15][0]*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,-x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))));
-    if (isNANorINF(t->fx[30]))
+    d->fx[30]=x[3]*p[15][0]*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,-x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))));
+    if (isNANorINF(d->fx[30]))
         {
-            PRNT("    @k %d: t->fx[30] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fx[30]);
+            PRNT("    @k %d: d->fx[30] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fx[30]);
             {
                 PRNT("        x[3]= %g\n",x[3]);
                 PRNT("        x[4]= %g\n",x[4]);
@@ -718,10 +1086,10 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fx[31]=sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,-x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))+x[3]*p[15][0]*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0));
-    if (isNANorINF(t->fx[31]))
+    d->fx[31]=sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,-x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))+x[3]*p[15][0]*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0));
+    if (isNANorINF(d->fx[31]))
         {
-            PRNT("    @k %d: t->fx[31] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fx[31]);
+            PRNT("    @k %d: d->fx[31] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fx[31]);
             {
                 PRNT("        x[3]= %g\n",x[3]);
                 PRNT("        x[4]= %g\n",x[4]);
@@ -730,7 +1098,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fx[33]=1.0+p[15][0]*(-p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*
+    d->fx[33]=1.0+p[15][0]*(-p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*
      pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-(u[0]-x[3])*p[7][0]*mcond(x[3]>0.0,1.0,1,-1.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)
      )/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-(u[0]-x[3])*p[7][0]*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[
      22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+(u[0]-x[3])*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(-2.0*pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),3.0)
@@ -741,9 +1109,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      (1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+
      abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))+p[6][0]*sin(u[1])*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),
      1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0];
-    if (isNANorINF(t->fx[33]))
+    if (isNANorINF(d->fx[33]))
         {
-            PRNT("    @k %d: t->fx[33] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fx[33]);
+            PRNT("    @k %d: d->fx[33] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fx[33]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -763,7 +1131,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fx[34]=p[15][0]*(-x[5]+((x[4]-x[5]*p[5][0])*p[6][0]*mcond(x[3]>0.0,1.0,1,-1.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),
+    d->fx[34]=p[15][0]*(-x[5]+((x[4]-x[5]*p[5][0])*p[6][0]*mcond(x[3]>0.0,1.0,1,-1.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),
      2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+(x[4]-x[5]*p[5][0])*p[6][0]*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001
      +abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(-2.0*pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),3.0)-2.0*pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)*mcond(x[3]>
      0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),3.0)-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-1/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-(u[0]-x[3])*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.16666666666666666*(2.0-p[22][0]/p[21][0])*(-2.0*pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),3.0)-2.0*pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),3.0)-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x
@@ -773,9 +1141,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      (x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(tan(
      mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))-p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)
      -0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0]);
-    if (isNANorINF(t->fx[34]))
+    if (isNANorINF(d->fx[34]))
         {
-            PRNT("    @k %d: t->fx[34] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fx[34]);
+            PRNT("    @k %d: d->fx[34] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fx[34]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        x[5]= %g\n",x[5]);
@@ -795,7 +1163,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fx[35]=p[15][0]*(-p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(x[3]>0.0,1.0,1,-1.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))
+    d->fx[35]=p[15][0]*(-p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(x[3]>0.0,1.0,1,-1.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))
      ),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)
      /pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(-2.0*pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),3.0)-2.0*pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),
      2.0)*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),3.0)-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-1/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-(u[0]-x[3])*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.16666666666666666*(2.0-p[22][0]/p[21][0])*(-2.0*pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),3.0)-2.0*pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),3.0)-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)
@@ -805,9 +1173,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))
      /pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))-p[4][0]*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0
      )/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[2][0];
-    if (isNANorINF(t->fx[35]))
+    if (isNANorINF(d->fx[35]))
         {
-            PRNT("    @k %d: t->fx[35] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fx[35]);
+            PRNT("    @k %d: d->fx[35] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fx[35]);
             {
                 PRNT("        p[2,0]= %g\n",p[2][0]);
                 PRNT("        p[15,0]= %g\n",p[15][0]);
@@ -828,10 +1196,10 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             return(0);
         }
 // df[i]/d x[4]
-    t->fx[40]=x[4]*p[15][0]*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))));
-    if (isNANorINF(t->fx[40]))
+    d->fx[40]=x[4]*p[15][0]*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))));
+    if (isNANorINF(d->fx[40]))
         {
-            PRNT("    @k %d: t->fx[40] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fx[40]);
+            PRNT("    @k %d: d->fx[40] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fx[40]);
             {
                 PRNT("        x[4]= %g\n",x[4]);
                 PRNT("        x[3]= %g\n",x[3]);
@@ -840,10 +1208,10 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fx[41]=sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))+x[4]*p[15][0]*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0));
-    if (isNANorINF(t->fx[41]))
+    d->fx[41]=sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))+x[4]*p[15][0]*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0));
+    if (isNANorINF(d->fx[41]))
         {
-            PRNT("    @k %d: t->fx[41] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fx[41]);
+            PRNT("    @k %d: d->fx[41] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fx[41]);
             {
                 PRNT("        x[3]= %g\n",x[3]);
                 PRNT("        x[4]= %g\n",x[4]);
@@ -852,14 +1220,14 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fx[43]=p[15][0]*(x[5]+((u[0]-x[3])*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(
+    d->fx[43]=p[15][0]*(x[5]+((u[0]-x[3])*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(
      pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+p[6][0]*sin(u[1])*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0
      ,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001
      +abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))+p[6][0]*sin(u[1])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0
      -0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0]);
-    if (isNANorINF(t->fx[43]))
+    if (isNANorINF(d->fx[43]))
         {
-            PRNT("    @k %d: t->fx[43] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fx[43]);
+            PRNT("    @k %d: d->fx[43] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fx[43]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        x[5]= %g\n",x[5]);
@@ -879,15 +1247,15 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fx[44]=1.0+p[15][0]*(-(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)
+    d->fx[44]=1.0+p[15][0]*(-(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)
      /pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow
      ((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-p[6][0]*cos(u[1])*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u
      [1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,1/(0.001+abs(x[3
      ]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))-p[6][0]*cos(u[1])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan
      ((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0];
-    if (isNANorINF(t->fx[44]))
+    if (isNANorINF(d->fx[44]))
         {
-            PRNT("    @k %d: t->fx[44] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fx[44]);
+            PRNT("    @k %d: d->fx[44] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fx[44]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -907,15 +1275,15 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fx[45]=p[15][0]*(p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),
+    d->fx[45]=p[15][0]*(p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),
      2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+p[5][0]*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6]
      [0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-p[4][0]*p[6][0]*cos(u[1])*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(
      sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]
      >=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))-p[4][0]*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/
      (0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[2][0];
-    if (isNANorINF(t->fx[45]))
+    if (isNANorINF(d->fx[45]))
         {
-            PRNT("    @k %d: t->fx[45] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fx[45]);
+            PRNT("    @k %d: d->fx[45] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fx[45]);
             {
                 PRNT("        p[2,0]= %g\n",p[2][0]);
                 PRNT("        p[15,0]= %g\n",p[15][0]);
@@ -936,14 +1304,14 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             return(0);
         }
 // df[i]/d x[5]
-    t->fx[53]=p[15][0]*(x[4]+((u[0]-x[3])*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(
+    d->fx[53]=p[15][0]*(x[4]+((u[0]-x[3])*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(
      0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+p[6][0]*sin(u[1])*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+
      abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][
      0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))+p[6][0]*sin(u[1])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=
      3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0]);
-    if (isNANorINF(t->fx[53]))
+    if (isNANorINF(d->fx[53]))
         {
-            PRNT("    @k %d: t->fx[53] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fx[53]);
+            PRNT("    @k %d: d->fx[53] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fx[53]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        x[4]= %g\n",x[4]);
@@ -963,15 +1331,15 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fx[54]=p[15][0]*(-x[3]+(-(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x
+    d->fx[54]=p[15][0]*(-x[3]+(-(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x
      [3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+p[5][0]*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+
      abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-p[6][0]*cos(u[1])*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(
      0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][
      0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))-p[6][0]*cos(u[1])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*
      pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0]);
-    if (isNANorINF(t->fx[54]))
+    if (isNANorINF(d->fx[54]))
         {
-            PRNT("    @k %d: t->fx[54] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fx[54]);
+            PRNT("    @k %d: d->fx[54] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fx[54]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        x[3]= %g\n",x[3]);
@@ -991,15 +1359,15 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fx[55]=1.0+p[15][0]*(p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[
+    d->fx[55]=1.0+p[15][0]*(p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[
      0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-pow(p[5][0],2.0)*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),
      2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-p[4][0]*p[6][0]*cos(u[1])*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p
      [4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3
      ]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))-p[4][0]*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)
      *mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[2][0];
-    if (isNANorINF(t->fx[55]))
+    if (isNANorINF(d->fx[55]))
         {
-            PRNT("    @k %d: t->fx[55] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fx[55]);
+            PRNT("    @k %d: d->fx[55] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fx[55]);
             {
                 PRNT("        p[2,0]= %g\n",p[2][0]);
                 PRNT("        p[15,0]= %g\n",p[15][0]);
@@ -1025,14 +1393,14 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
 // df[i]/d x[9]
 
 // df[i]/d u[0]
-    t->fu[3]=p[15][0]*((u[0]-x[3])*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.16666666666666666*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(
+    d->fu[3]=p[15][0]*((u[0]-x[3])*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.16666666666666666*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(
      0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[1][0]/p[21][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-0.5*p[1][0]*p[22][0]*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-(u[0]-x[3])*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/
      (1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs
      (x[3]),2.0)))/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs
      (x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[20][0];
-    if (isNANorINF(t->fu[3]))
+    if (isNANorINF(d->fu[3]))
         {
-            PRNT("    @k %d: t->fu[3] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fu[3]);
+            PRNT("    @k %d: d->fu[3] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fu[3]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -1049,13 +1417,13 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fu[4]=p[15][0]*(-(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.16666666666666666*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x
+    d->fu[4]=p[15][0]*(-(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.16666666666666666*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x
      [3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[1][0]/p[21][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-0.5*p[1][0]*p[22][0]*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*
      pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),
      2.0)/pow(0.001+abs(x[3]),2.0)))/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/p[20][0];
-    if (isNANorINF(t->fu[4]))
+    if (isNANorINF(d->fu[4]))
         {
-            PRNT("    @k %d: t->fu[4] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fu[4]);
+            PRNT("    @k %d: d->fu[4] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fu[4]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -1072,13 +1440,13 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fu[5]=p[15][0]*(p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.16666666666666666*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+
+    d->fu[5]=p[15][0]*(p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.16666666666666666*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+
      (u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[1][0]/p[21][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-0.5*p[1][0]*p[22][0]*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(
      p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+
      abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/p[2][0];
-    if (isNANorINF(t->fu[5]))
+    if (isNANorINF(d->fu[5]))
         {
-            PRNT("    @k %d: t->fu[5] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fu[5]);
+            PRNT("    @k %d: d->fu[5] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fu[5]);
             {
                 PRNT("        p[2,0]= %g\n",p[2][0]);
                 PRNT("        p[15,0]= %g\n",p[15][0]);
@@ -1096,13 +1464,13 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             return(0);
         }
 // df[i]/d u[1]
-    t->fu[13]=p[15][0]*(p[6][0]*sin(u[1])*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4
+    d->fu[13]=p[15][0]*(p[6][0]*sin(u[1])*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4
      ]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))+p[6][0]*sin(u[1])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x
      [5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))+p[6][0]*cos(u[1])*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+
      atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0];
-    if (isNANorINF(t->fu[13]))
+    if (isNANorINF(d->fu[13]))
         {
-            PRNT("    @k %d: t->fu[13] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fu[13]);
+            PRNT("    @k %d: d->fu[13] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fu[13]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -1118,13 +1486,13 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fu[14]=p[15][0]*(-p[6][0]*cos(u[1])*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[
+    d->fu[14]=p[15][0]*(-p[6][0]*cos(u[1])*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[
      4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))-p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*
      x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))+p[6][0]*sin(u[1])*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]
      +atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0];
-    if (isNANorINF(t->fu[14]))
+    if (isNANorINF(d->fu[14]))
         {
-            PRNT("    @k %d: t->fu[14] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fu[14]);
+            PRNT("    @k %d: d->fu[14] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fu[14]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -1140,13 +1508,13 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fu[15]=p[15][0]*(-p[4][0]*p[6][0]*cos(u[1])*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+
+    d->fu[15]=p[15][0]*(-p[4][0]*p[6][0]*cos(u[1])*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+
      atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))-p[4][0]*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+
      atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))+p[4][0]*p[6][0]*sin(u[1])*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5]
      )/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[2][0];
-    if (isNANorINF(t->fu[15]))
+    if (isNANorINF(d->fu[15]))
         {
-            PRNT("    @k %d: t->fu[15] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fu[15]);
+            PRNT("    @k %d: d->fu[15] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fu[15]);
             {
                 PRNT("        p[2,0]= %g\n",p[2][0]);
                 PRNT("        p[15,0]= %g\n",p[15][0]);
@@ -1168,10 +1536,10 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
 // j= 0
 // j= 1
 // j= 2
-    t->fxx[5]=-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))));
-    if (isNANorINF(t->fxx[5]))
+    d->fxx[5]=-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))));
+    if (isNANorINF(d->fxx[5]))
         {
-            PRNT("    @k %d: t->fxx[5] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[5]);
+            PRNT("    @k %d: d->fxx[5] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[5]);
             {
                 PRNT("        x[3]= %g\n",x[3]);
                 PRNT("        x[4]= %g\n",x[4]);
@@ -1181,10 +1549,10 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             return(0);
         }
 // j= 3
-    t->fxx[8]=-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,-x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))-x[3]*p[15][0]*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0));
-    if (isNANorINF(t->fxx[8]))
+    d->fxx[8]=-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,-x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))-x[3]*p[15][0]*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0));
+    if (isNANorINF(d->fxx[8]))
         {
-            PRNT("    @k %d: t->fxx[8] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[8]);
+            PRNT("    @k %d: d->fxx[8] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[8]);
             {
                 PRNT("        x[3]= %g\n",x[3]);
                 PRNT("        x[4]= %g\n",x[4]);
@@ -1193,13 +1561,13 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxx[9]=-pow(x[3],2.0)*p[15][0]*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),1.5)+p[15][0]*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*pow(mcond(x[3]<0.0&&x[4]>0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,-x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)))),2.0)*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+
+    d->fxx[9]=-pow(x[3],2.0)*p[15][0]*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),1.5)+p[15][0]*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*pow(mcond(x[3]<0.0&&x[4]>0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,-x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)))),2.0)*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+
      abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))-2.0*x[3]*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,-x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,x[4]*mcond(x[3]>0.0,0.0,1,0.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))+2.0*pow(x[4],3.0)*pow(mcond(x[3]>0.0,1.0,1,-1.0),2.0)/pow(0.001+abs(x[3]),5.0)/pow(1.0+
      pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0),2.0)-2.0*x[4]*pow(mcond(x[3]>0.0,1.0,1,-1.0),2.0)/pow(0.001+abs(x[3]),3.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,x[4]*mcond(x[3]>0.0,0.0,1,0.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))+2.0*pow(x[4],3.0)*pow(mcond(x[3]>0.0,1.0,1,-1.0),2.0)/pow(0.001+abs(x[3]),5.0)/pow(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0),2.0)-2.0*x[4]*pow(mcond(x[3]>0.0,1.0,1,-1.0),2.0)/pow(0.001+abs(x[3]),3.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,-x[4]*mcond(x[3]>0.0,0.0,1,0.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))-2.0*pow(x[4],3.0)*pow(mcond(x[3]>0.0,1.0,1,-1.0),2.0)/pow(0.001+abs(x[3]),5.0)/pow(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0),2.0)+2.0*x[4]*pow(mcond(x[3]>0.0,1.0,1,-1.0),2.0)/pow(0.001+abs(x[3]),3.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,
      -3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))));
-    if (isNANorINF(t->fxx[9]))
+    if (isNANorINF(d->fxx[9]))
         {
-            PRNT("    @k %d: t->fxx[9] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[9]);
+            PRNT("    @k %d: d->fxx[9] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[9]);
             {
                 PRNT("        x[3]= %g\n",x[3]);
                 PRNT("        x[4]= %g\n",x[4]);
@@ -1209,10 +1577,10 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             return(0);
         }
 // j= 4
-    t->fxx[12]=-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))-x[4]*p[15][0]*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0));
-    if (isNANorINF(t->fxx[12]))
+    d->fxx[12]=-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))-x[4]*p[15][0]*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0));
+    if (isNANorINF(d->fxx[12]))
         {
-            PRNT("    @k %d: t->fxx[12] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[12]);
+            PRNT("    @k %d: d->fxx[12] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[12]);
             {
                 PRNT("        x[3]= %g\n",x[3]);
                 PRNT("        x[4]= %g\n",x[4]);
@@ -1221,13 +1589,13 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxx[13]=-x[3]*x[4]*p[15][0]*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),1.5)-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*mcond(x[3]<0.0&&x[4]>0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,-x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(
+    d->fxx[13]=-x[3]*x[4]*p[15][0]*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),1.5)-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*mcond(x[3]<0.0&&x[4]>0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,-x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(
      0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))-x[3]*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))-x[4]*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,-x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),
      2.0))))*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,-2.0*pow(x[4],2.0)*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),4.0)/pow(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0),2.0)+mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,-2.0*pow(x[4],2.0)*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),4.0)/pow(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0),2.0)+mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,2.0*pow(x[4],2.0)*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),4.0)/pow(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0),2.0)-mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),
      2.0))))*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))));
-    if (isNANorINF(t->fxx[13]))
+    if (isNANorINF(d->fxx[13]))
         {
-            PRNT("    @k %d: t->fxx[13] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[13]);
+            PRNT("    @k %d: d->fxx[13] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[13]);
             {
                 PRNT("        x[3]= %g\n",x[3]);
                 PRNT("        x[4]= %g\n",x[4]);
@@ -1236,12 +1604,12 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxx[14]=-pow(x[4],2.0)*p[15][0]*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),1.5)+p[15][0]*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*pow(mcond(x[3]<0.0&&x[4]>0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)))),2.0)*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs
+    d->fxx[14]=-pow(x[4],2.0)*p[15][0]*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),1.5)+p[15][0]*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*pow(mcond(x[3]<0.0&&x[4]>0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)))),2.0)*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs
      (x[3]))))))-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,2.0*x[4]/pow(0.001+abs(x[3]),3.0)/pow(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0),2.0),1,mcond(x[3]<0.0&&x[4]<0.0,2.0*x[4]/pow(0.001+abs(x[3]),3.0)/pow(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0),2.0),1,-2.0*x[4]/pow(0.001+abs(x[3]),3.0)/pow(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0),2.0)))*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))-2.0*x[4]*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,
      atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0));
-    if (isNANorINF(t->fxx[14]))
+    if (isNANorINF(d->fxx[14]))
         {
-            PRNT("    @k %d: t->fxx[14] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[14]);
+            PRNT("    @k %d: d->fxx[14] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[14]);
             {
                 PRNT("        x[4]= %g\n",x[4]);
                 PRNT("        x[3]= %g\n",x[3]);
@@ -1259,10 +1627,10 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
 // j= 0
 // j= 1
 // j= 2
-    t->fxx[60]=-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))));
-    if (isNANorINF(t->fxx[60]))
+    d->fxx[60]=-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))));
+    if (isNANorINF(d->fxx[60]))
         {
-            PRNT("    @k %d: t->fxx[60] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[60]);
+            PRNT("    @k %d: d->fxx[60] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[60]);
             {
                 PRNT("        x[3]= %g\n",x[3]);
                 PRNT("        x[4]= %g\n",x[4]);
@@ -1272,10 +1640,10 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             return(0);
         }
 // j= 3
-    t->fxx[63]=x[3]*p[15][0]*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,-x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))));
-    if (isNANorINF(t->fxx[63]))
+    d->fxx[63]=x[3]*p[15][0]*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,-x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))));
+    if (isNANorINF(d->fxx[63]))
         {
-            PRNT("    @k %d: t->fxx[63] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[63]);
+            PRNT("    @k %d: d->fxx[63] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[63]);
             {
                 PRNT("        x[3]= %g\n",x[3]);
                 PRNT("        x[4]= %g\n",x[4]);
@@ -1284,13 +1652,13 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxx[64]=2.0*x[3]*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,-x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))+sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,x[4]*mcond(x[3]>0.0,0.0,1,0.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))+2.0*pow(x[4],3.0)*pow(mcond(x[3]>0.0,1.0,1,-1.0),2.0)/pow(0.001+abs(x[3]),5.0)/pow(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0),2.0)-2.0*x[4]*pow(mcond(x[3]>0.0,1.0,1,-1.0),2.0)/pow(0.001+abs(x[3]),3.0
+    d->fxx[64]=2.0*x[3]*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,-x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))+sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,x[4]*mcond(x[3]>0.0,0.0,1,0.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))+2.0*pow(x[4],3.0)*pow(mcond(x[3]>0.0,1.0,1,-1.0),2.0)/pow(0.001+abs(x[3]),5.0)/pow(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0),2.0)-2.0*x[4]*pow(mcond(x[3]>0.0,1.0,1,-1.0),2.0)/pow(0.001+abs(x[3]),3.0
      )/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,x[4]*mcond(x[3]>0.0,0.0,1,0.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))+2.0*pow(x[4],3.0)*pow(mcond(x[3]>0.0,1.0,1,-1.0),2.0)/pow(0.001+abs(x[3]),5.0)/pow(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0),2.0)-2.0*x[4]*pow(mcond(x[3]>0.0,1.0,1,-1.0),2.0)/pow(0.001+abs(x[3]),3.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,-x[4]*mcond(x[3]>0.0,0.0,1,0.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))-2.0*pow(x[4],3.0)*pow(mcond(x[3]>0.0,1.0,1,-1.0),2.0)/pow(0.001+abs(x[3]),5.0)/pow(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0),2.0)+2.0*x[4]*pow(mcond(x[3]>0.0,1.0,1,-1.0),2.0)/pow(0.001+abs(x[3]),3.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))-pow(x[3],2.0)*p[15][0]*sin(x[2]+
      mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),1.5)+p[15][0]*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*pow(mcond(x[3]<0.0&&x[4]>0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,-x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)))),2.0)*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,
      -3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))));
-    if (isNANorINF(t->fxx[64]))
+    if (isNANorINF(d->fxx[64]))
         {
-            PRNT("    @k %d: t->fxx[64] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[64]);
+            PRNT("    @k %d: d->fxx[64] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[64]);
             {
                 PRNT("        x[3]= %g\n",x[3]);
                 PRNT("        x[4]= %g\n",x[4]);
@@ -1300,10 +1668,10 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             return(0);
         }
 // j= 4
-    t->fxx[67]=x[4]*p[15][0]*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))));
-    if (isNANorINF(t->fxx[67]))
+    d->fxx[67]=x[4]*p[15][0]*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))));
+    if (isNANorINF(d->fxx[67]))
         {
-            PRNT("    @k %d: t->fxx[67] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[67]);
+            PRNT("    @k %d: d->fxx[67] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[67]);
             {
                 PRNT("        x[4]= %g\n",x[4]);
                 PRNT("        x[3]= %g\n",x[3]);
@@ -1312,13 +1680,13 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxx[68]=x[3]*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))+x[4]*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,-x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,
+    d->fxx[68]=x[3]*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))+x[4]*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,-x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,
      -3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))+sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,-2.0*pow(x[4],2.0)*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),4.0)/pow(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0),2.0)+mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,-2.0*pow(x[4],2.0)*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),4.0)/pow(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0),2.0)+mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,2.0*pow(x[4],2.0)*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),4.0)/pow(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0),2.0)-mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,
      -3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))-x[3]*x[4]*p[15][0]*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),1.5)-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*mcond(x[3]<0.0&&x[4]>0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,-x[4]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)
      )))*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))));
-    if (isNANorINF(t->fxx[68]))
+    if (isNANorINF(d->fxx[68]))
         {
-            PRNT("    @k %d: t->fxx[68] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[68]);
+            PRNT("    @k %d: d->fxx[68] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[68]);
             {
                 PRNT("        x[3]= %g\n",x[3]);
                 PRNT("        x[4]= %g\n",x[4]);
@@ -1327,12 +1695,12 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxx[69]=sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,2.0*x[4]/pow(0.001+abs(x[3]),3.0)/pow(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0),2.0),1,mcond(x[3]<0.0&&x[4]<0.0,2.0*x[4]/pow(0.001+abs(x[3]),3.0)/pow(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0),2.0),1,-2.0*x[4]/pow(0.001+abs(x[3]),3.0)/pow(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0),2.0)))*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))+2.0*x[4]*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,
+    d->fxx[69]=sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,2.0*x[4]/pow(0.001+abs(x[3]),3.0)/pow(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0),2.0),1,mcond(x[3]<0.0&&x[4]<0.0,2.0*x[4]/pow(0.001+abs(x[3]),3.0)/pow(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0),2.0),1,-2.0*x[4]/pow(0.001+abs(x[3]),3.0)/pow(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0),2.0)))*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))+2.0*x[4]*p[15][0]*mcond(x[3]<0.0&&x[4]>0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0))))*cos(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,
      atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))-pow(x[4],2.0)*p[15][0]*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),1.5)+p[15][0]*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,-3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))-sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))*p[15][0]*pow(mcond(x[3]<0.0&&x[4]>0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,mcond(x[3]<0.0&&x[4]<0.0,-1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4],2.0)/pow(0.001+abs(x[3]),2.0)))),2.0)*sin(x[2]+mcond(x[3]<0.0&&x[4]>0.0,3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,mcond(x[3]<0.0&&x[4]<0.0,
      -3.141592653589793-atan(x[4]/(0.001+abs(x[3]))),1,atan(x[4]/(0.001+abs(x[3]))))));
-    if (isNANorINF(t->fxx[69]))
+    if (isNANorINF(d->fxx[69]))
         {
-            PRNT("    @k %d: t->fxx[69] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[69]);
+            PRNT("    @k %d: d->fxx[69] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[69]);
             {
                 PRNT("        x[3]= %g\n",x[3]);
                 PRNT("        x[4]= %g\n",x[4]);
@@ -1362,7 +1730,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
 // j= 1
 // j= 2
 // j= 3
-    t->fxx[174]=p[15][0]*(-(u[0]-x[3])*p[7][0]*mcond(x[3]>0.0,0.0,1,0.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(
+    d->fxx[174]=p[15][0]*(-(u[0]-x[3])*p[7][0]*mcond(x[3]>0.0,0.0,1,0.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(
      0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+2.0*p[7][0]*mcond(x[3]>0.0,1.0,1,-1.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(
      x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+2.0*p[7][0]*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0
      )-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+2.0*(u[0]-x[3])*p[7][0]*mcond(x[3]>0.0,1.0,1,-1.0)*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[
@@ -1407,9 +1775,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      pow(0.001+abs(x[3]),2.0))-2.0*pow(x[4]+p[4][0]*x[5],3.0)*pow(mcond(x[3]>0.0,1.0,1,-1.0),2.0)/pow(0.001+abs(x[3]),5.0)/pow(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0),2.0)+2.0*(x[4]+p[4][0]*x[5])*pow(mcond(x[3]>0.0,1.0,1,-1.0),2.0)/pow(0.001+abs(x[3]),3.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[
      4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))+2.0*p[6][0]*sin(u[1])*pow(mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0))),2.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+
      abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0];
-    if (isNANorINF(t->fxx[174]))
+    if (isNANorINF(d->fxx[174]))
         {
-            PRNT("    @k %d: t->fxx[174] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[174]);
+            PRNT("    @k %d: d->fxx[174] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[174]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -1430,7 +1798,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             return(0);
         }
 // j= 4
-    t->fxx[178]=p[15][0]*(-p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*
+    d->fxx[178]=p[15][0]*(-p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*
      pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-(u[0]-x[3])*p[7][0]*mcond(x[3]>0.0,1.0,1,-1.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs
      (x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-(u[0]-x[3])*p[7][0]*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][
      0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+(u[0]-x[3])*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0
@@ -1457,9 +1825,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))+2.0*p[6][0]*sin(u[1])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(
      x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0]
      ,2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0];
-    if (isNANorINF(t->fxx[178]))
+    if (isNANorINF(d->fxx[178]))
         {
-            PRNT("    @k %d: t->fxx[178] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[178]);
+            PRNT("    @k %d: d->fxx[178] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[178]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -1479,7 +1847,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxx[179]=p[15][0]*((u[0]-x[3])*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],4.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/
+    d->fxx[179]=p[15][0]*((u[0]-x[3])*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],4.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/
      sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,3.0*p[1][0]*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],4.0)*p[22][0]/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),2.5)-p[1][0]*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+2.0*p[6][0]*sin(u[1])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(
      1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0
      )-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[
@@ -1493,9 +1861,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      (x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))+p[6][0]*sin(u[1])*mcond(x[3]>=0.0,-2.0*(x[4]+p[4][0]*x[5])/pow(0.001+abs(x[3]),3.0)/pow(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0),2.0),1,-2.0*(x[4]+p[4][0]*x[5])/pow(0.001+abs(x[3]),3.0)/pow(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0),2.0))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0
      +0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))+2.0*p[6][0]*sin(u[1])*pow(mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0))),2.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,
      -u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0];
-    if (isNANorINF(t->fxx[179]))
+    if (isNANorINF(d->fxx[179]))
         {
-            PRNT("    @k %d: t->fxx[179] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[179]);
+            PRNT("    @k %d: d->fxx[179] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[179]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -1516,7 +1884,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             return(0);
         }
 // j= 5
-    t->fxx[183]=p[15][0]*(-p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),
+    d->fxx[183]=p[15][0]*(-p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),
      2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-(u[0]-x[3])*p[7][0]*mcond(x[3]>0.0,1.0,1,-1.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-
      x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-(u[0]-x[3])*p[7][0]*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0
      -0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+(u[0]-x[3])*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x
@@ -1543,9 +1911,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      /pow(0.001+abs(x[3]),2.0)),1,2.0*p[4][0]*pow(x[4]+p[4][0]*x[5],2.0)*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),4.0)/pow(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0),2.0)-p[4][0]*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001
      +abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))+2.0*p[6][0]*sin(u[1])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+
      abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0];
-    if (isNANorINF(t->fxx[183]))
+    if (isNANorINF(d->fxx[183]))
         {
-            PRNT("    @k %d: t->fxx[183] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[183]);
+            PRNT("    @k %d: d->fxx[183] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[183]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -1565,7 +1933,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxx[184]=p[15][0]*(1.0+((u[0]-x[3])*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*p[5][0]*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],4.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5)+0.3333333333333333*p[5][0]*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]
+    d->fxx[184]=p[15][0]*(1.0+((u[0]-x[3])*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*p[5][0]*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],4.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5)+0.3333333333333333*p[5][0]*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]
      -x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-3.0*p[1][0]*p[5][0]*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],4.0)*p[22][0]/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),2.5)+p[1][0]*p[5][0]*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+p[6][0]*sin(u[
      1])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(
      0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(
@@ -1584,9 +1952,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      *p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))+2.0*p[6][0]*sin(u[1])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan
      ((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan
      ((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0]);
-    if (isNANorINF(t->fxx[184]))
+    if (isNANorINF(d->fxx[184]))
         {
-            PRNT("    @k %d: t->fxx[184] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[184]);
+            PRNT("    @k %d: d->fxx[184] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[184]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -1606,7 +1974,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxx[185]=p[15][0]*((u[0]-x[3])*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*pow(p[5][0],2.0)*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*pow(p[5][0],2.0)*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],4.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5)-0.3333333333333333*pow(p[5][0],2.0)*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3
+    d->fxx[185]=p[15][0]*((u[0]-x[3])*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*pow(p[5][0],2.0)*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*pow(p[5][0],2.0)*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],4.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5)-0.3333333333333333*pow(p[5][0],2.0)*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3
      ]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,3.0*p[1][0]*pow(p[5][0],2.0)*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],4.0)*p[22][0]/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),2.5)-p[1][0]*pow(p[5][0],2.0)*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x
      [3])/(0.001+abs(x[3])))+2.0*p[6][0]*sin(u[1])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5]
      )/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x
@@ -1621,9 +1989,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0),2.0))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0
      )))+2.0*p[6][0]*sin(u[1])*pow(mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0))),2.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=
      0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0];
-    if (isNANorINF(t->fxx[185]))
+    if (isNANorINF(d->fxx[185]))
         {
-            PRNT("    @k %d: t->fxx[185] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[185]);
+            PRNT("    @k %d: d->fxx[185] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[185]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -1652,7 +2020,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
 // j= 1
 // j= 2
 // j= 3
-    t->fxx[229]=p[15][0]*((x[4]-x[5]*p[5][0])*p[6][0]*mcond(x[3]>0.0,0.0,1,0.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/
+    d->fxx[229]=p[15][0]*((x[4]-x[5]*p[5][0])*p[6][0]*mcond(x[3]>0.0,0.0,1,0.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/
      pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-2.0*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(x[3]>0.0,1.0,1,-1.0)*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+
      abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-2.0*(x[4]-x[5]*p[5][0])*p[6][0]*pow(mcond(x[3]>0.0,1.0,1,-1.0),2.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[
      3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/pow(0.001+abs(x[3]),3.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+(x[4]-x[5]*p[5][0])*p[6][0]*(-(u[0]-x[3])*mcond(x[3]>0.0,0.0,1,0.0)/pow(0.001+abs(x[3]),2.0)+2.0*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)+2.0*(u[0]-x[3])*pow(mcond(x[3]>0.0,1.0,1,-1.0),2.0)/pow(0.001+abs(x[3]),3.0))*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(
@@ -1692,9 +2060,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))-2.0*p[6][0]*cos(u[1])*pow(mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>
      0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0))),2.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0]
      [0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0];
-    if (isNANorINF(t->fxx[229]))
+    if (isNANorINF(d->fxx[229]))
         {
-            PRNT("    @k %d: t->fxx[229] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[229]);
+            PRNT("    @k %d: d->fxx[229] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[229]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -1715,7 +2083,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             return(0);
         }
 // j= 4
-    t->fxx[233]=p[15][0]*((x[4]-x[5]*p[5][0])*p[6][0]*mcond(x[3]>0.0,1.0,1,-1.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3]
+    d->fxx[233]=p[15][0]*((x[4]-x[5]*p[5][0])*p[6][0]*mcond(x[3]>0.0,1.0,1,-1.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3]
      )/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+(x[4]-x[5]*p[5][0])*p[6][0]*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-
      x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+p[6][0]*mcond(x[3]>0.0,1.0,1,-1.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0
      ],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+p[6][0]*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]
@@ -1746,9 +2114,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      2.0)*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),4.0)/pow(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0),2.0)-mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))
      /p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))-2.0*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+
      p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0];
-    if (isNANorINF(t->fxx[233]))
+    if (isNANorINF(d->fxx[233]))
         {
-            PRNT("    @k %d: t->fxx[233] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[233]);
+            PRNT("    @k %d: d->fxx[233] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[233]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -1768,7 +2136,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxx[234]=p[15][0]*(-(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],4.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3
+    d->fxx[234]=p[15][0]*(-(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],4.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3
      ])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,3.0*p[1][0]*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],4.0)*p[22][0]/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),2.5)-p[1][0]*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-2.0*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[
      3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs
      (x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-2.0*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x
@@ -1784,9 +2152,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))-2.0*p[6][0]*cos(u[1])*pow(mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)
      ),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0))),2.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[
      0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0];
-    if (isNANorINF(t->fxx[234]))
+    if (isNANorINF(d->fxx[234]))
         {
-            PRNT("    @k %d: t->fxx[234] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[234]);
+            PRNT("    @k %d: d->fxx[234] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[234]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -1807,7 +2175,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             return(0);
         }
 // j= 5
-    t->fxx[238]=p[15][0]*(-1.0+((x[4]-x[5]*p[5][0])*p[6][0]*mcond(x[3]>0.0,1.0,1,-1.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs
+    d->fxx[238]=p[15][0]*(-1.0+((x[4]-x[5]*p[5][0])*p[6][0]*mcond(x[3]>0.0,1.0,1,-1.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs
      (x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+(x[4]-x[5]*p[5][0])*p[6][0]*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p
      [21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-p[5][0]*p[6][0]*mcond(x[3]>0.0,1.0,1,-1.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+
      0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-p[5][0]*p[6][0]*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))*mcond(sqrt(pow(p[7][0]
@@ -1839,9 +2207,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      *pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))-2.0*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5]
      )*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),
      2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0]);
-    if (isNANorINF(t->fxx[238]))
+    if (isNANorINF(d->fxx[238]))
         {
-            PRNT("    @k %d: t->fxx[238] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[238]);
+            PRNT("    @k %d: d->fxx[238] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[238]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -1861,7 +2229,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxx[239]=p[15][0]*(-(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*p[5][0]*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],4.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5)+0.3333333333333333*p[5][0]*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(
+    d->fxx[239]=p[15][0]*(-(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*p[5][0]*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],4.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5)+0.3333333333333333*p[5][0]*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(
      u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-3.0*p[1][0]*p[5][0]*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],4.0)*p[22][0]/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),2.5)+p[1][0]*p[5][0]*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+p[5][0]*p[
      6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[
      0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[
@@ -1882,9 +2250,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      *(x[4]+p[4][0]*x[5])/pow(0.001+abs(x[3]),3.0)/pow(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0),2.0))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+
      abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))-2.0*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]
      >=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0];
-    if (isNANorINF(t->fxx[239]))
+    if (isNANorINF(d->fxx[239]))
         {
-            PRNT("    @k %d: t->fxx[239] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[239]);
+            PRNT("    @k %d: d->fxx[239] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[239]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -1904,7 +2272,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxx[240]=p[15][0]*(2.0*p[5][0]*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+
+    d->fxx[240]=p[15][0]*(2.0*p[5][0]*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+
      abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*pow(p[5][0],2.0)*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*pow(p[5][0],2.0)*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],4.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])
      /(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5)-0.3333333333333333*pow(p[5][0],2.0)*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,3.0*p[1][0]*pow(p[5][0],2.0)*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],4.0)*p[22][0]/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),2.5)-p[1][0]*pow(p[5][0],2.0)*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[
      3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-2.0*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),
@@ -1920,9 +2288,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      3]))))),2.0),1.5))-p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-2.0*pow(p[4][0],2.0)*(x[4]+p[4][0]*x[5])/pow(0.001+abs(x[3]),3.0)/pow(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0),2.0),1,-2.0*pow(p[4][0],2.0)*(x[4]+p[4][0]*x[5])/pow(0.001+abs(x[3]),3.0)/pow(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0),2.0))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4]
      [0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))-2.0*p[6][0]*cos(u[1])*pow(mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0))),2.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0
      -0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0];
-    if (isNANorINF(t->fxx[240]))
+    if (isNANorINF(d->fxx[240]))
         {
-            PRNT("    @k %d: t->fxx[240] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[240]);
+            PRNT("    @k %d: d->fxx[240] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[240]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -1951,7 +2319,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
 // j= 1
 // j= 2
 // j= 3
-    t->fxx[284]=p[15][0]*(-p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(x[3]>0.0,0.0,1,0.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3])
+    d->fxx[284]=p[15][0]*(-p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(x[3]>0.0,0.0,1,0.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3])
      )),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+2.0*p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(x[3]>0.0,1.0,1,-1.0)*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[
      0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+2.0*p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*pow(mcond(x[3]>0.0,1.0,1,-1.0),2.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5
      ]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/pow(0.001+abs(x[3]),3.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*(-(u[0]-x[3])*mcond(x[3]>0.0,0.0,1,0.0)/pow(0.001+abs(x[3]),2.0)+2.0*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)+2.0*(u[0]-x[3])*pow(mcond(x[3]>0.0,1.0,1,-1.0),2.0)/pow(0.001+abs(x[3]),3.0))*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),
@@ -1991,9 +2359,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))-2.0*p[4][0]*p[6][0]*cos(u[1])*pow(mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+
      pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0))),2.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x
      [5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[2][0];
-    if (isNANorINF(t->fxx[284]))
+    if (isNANorINF(d->fxx[284]))
         {
-            PRNT("    @k %d: t->fxx[284] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[284]);
+            PRNT("    @k %d: d->fxx[284] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[284]);
             {
                 PRNT("        p[2,0]= %g\n",p[2][0]);
                 PRNT("        p[15,0]= %g\n",p[15][0]);
@@ -2014,7 +2382,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             return(0);
         }
 // j= 4
-    t->fxx[288]=p[15][0]*(-p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(x[3]>0.0,1.0,1,-1.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(
+    d->fxx[288]=p[15][0]*(-p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(x[3]>0.0,1.0,1,-1.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(
      u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),
      2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-p[5][0]*p[6][0]*mcond(x[3]>0.0,1.0,1,-1.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[
      22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-p[5][0]*p[6][0]*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001
@@ -2045,9 +2413,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,2.0*pow(x[4]+p[4][0]*x[5],2.0)*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),4.0)/pow(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0),2.0)-mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[
      5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))-2.0*p[4][0]*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(
      0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[2][0];
-    if (isNANorINF(t->fxx[288]))
+    if (isNANorINF(d->fxx[288]))
         {
-            PRNT("    @k %d: t->fxx[288] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[288]);
+            PRNT("    @k %d: d->fxx[288] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[288]);
             {
                 PRNT("        p[2,0]= %g\n",p[2][0]);
                 PRNT("        p[15,0]= %g\n",p[15][0]);
@@ -2067,7 +2435,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxx[289]=p[15][0]*(p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],4.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+
+    d->fxx[289]=p[15][0]*(p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],4.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+
      abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,3.0*p[1][0]*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],4.0)*p[22][0]/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),2.5)-p[1][0]*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+2.0*p[5][0]*p[6][0]*mcond(sqrt(pow(p[7][0],
      2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),
      2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-2.0*p[4][0]*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,
@@ -2083,9 +2451,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))-2.0*p[4][0]*p[6][0]*cos(u[1])*pow(mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/
      (1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0))),2.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0
      ]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[2][0];
-    if (isNANorINF(t->fxx[289]))
+    if (isNANorINF(d->fxx[289]))
         {
-            PRNT("    @k %d: t->fxx[289] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[289]);
+            PRNT("    @k %d: d->fxx[289] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[289]);
             {
                 PRNT("        p[2,0]= %g\n",p[2][0]);
                 PRNT("        p[15,0]= %g\n",p[15][0]);
@@ -2106,7 +2474,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             return(0);
         }
 // j= 5
-    t->fxx[293]=p[15][0]*(-p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(x[3]>0.0,1.0,1,-1.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+
+    d->fxx[293]=p[15][0]*(-p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(x[3]>0.0,1.0,1,-1.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+
      abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0]
      )/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+pow(p[5][0],2.0)*p[6][0]*mcond(x[3]>0.0,1.0,1,-1.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21
      ][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+pow(p[5][0],2.0)*p[6][0]*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))*
@@ -2138,9 +2506,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      +abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))-2.0*p[4][0]*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+
      pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/
      (0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[2][0];
-    if (isNANorINF(t->fxx[293]))
+    if (isNANorINF(d->fxx[293]))
         {
-            PRNT("    @k %d: t->fxx[293] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[293]);
+            PRNT("    @k %d: d->fxx[293] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[293]);
             {
                 PRNT("        p[2,0]= %g\n",p[2][0]);
                 PRNT("        p[15,0]= %g\n",p[15][0]);
@@ -2160,7 +2528,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxx[294]=p[15][0]*(p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*p[5][0]*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],4.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5)+0.3333333333333333*p[5][0]*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/
+    d->fxx[294]=p[15][0]*(p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*p[5][0]*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],4.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5)+0.3333333333333333*p[5][0]*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/
      pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-3.0*p[1][0]*p[5][0]*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],4.0)*p[22][0]/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),2.5)+p[1][0]*p[5][0]*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-
      pow(p[5][0],2.0)*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((
      u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+p[5][0]*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6
@@ -2181,9 +2549,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      ]*x[5],2.0)/pow(0.001+abs(x[3]),2.0),2.0),1,-2.0*p[4][0]*(x[4]+p[4][0]*x[5])/pow(0.001+abs(x[3]),3.0)/pow(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0),2.0))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(
      tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))-2.0*p[4][0]*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],
      2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[2][0];
-    if (isNANorINF(t->fxx[294]))
+    if (isNANorINF(d->fxx[294]))
         {
-            PRNT("    @k %d: t->fxx[294] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[294]);
+            PRNT("    @k %d: d->fxx[294] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[294]);
             {
                 PRNT("        p[2,0]= %g\n",p[2][0]);
                 PRNT("        p[15,0]= %g\n",p[15][0]);
@@ -2203,7 +2571,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxx[295]=p[15][0]*(-2.0*pow(p[5][0],2.0)*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])
+    d->fxx[295]=p[15][0]*(-2.0*pow(p[5][0],2.0)*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])
      /(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*pow(p[5][0],2.0)*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*pow(p[5][0],2.0)*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],4.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/
      (1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5)-0.3333333333333333*pow(p[5][0],2.0)*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,3.0*p[1][0]*pow(p[5][0],2.0)*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],4.0)*p[22][0]/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),2.5)-p[1][0]*pow(p[5][0],2.0)*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/
      pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-2.0*p[4][0]*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],
@@ -2219,9 +2587,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))-p[4][0]*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-2.0*pow(p[4][0],2.0)*(x[4]+p[4][0]*x[5])/pow(0.001+abs(x[3]),3.0)/pow(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0),2.0),1,-2.0*pow(p[4][0],2.0)*(x[4]+p[4][0]*x[5])/pow(0.001+abs(x[3]),3.0)/pow(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0),2.0))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)
      *pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))-2.0*p[4][0]*p[6][0]*cos(u[1])*pow(mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0))),2.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+
      0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[2][0];
-    if (isNANorINF(t->fxx[295]))
+    if (isNANorINF(d->fxx[295]))
         {
-            PRNT("    @k %d: t->fxx[295] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxx[295]);
+            PRNT("    @k %d: d->fxx[295] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxx[295]);
             {
                 PRNT("        p[2,0]= %g\n",p[2][0]);
                 PRNT("        p[15,0]= %g\n",p[15][0]);
@@ -2301,7 +2669,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
 // j= 1
 // d^2f[3]/du[i] du[j]
 // j= 0
-    t->fuu[9]=p[15][0]*((u[0]-x[3])*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(6.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(2.0*(u[0]-x[3])/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)-2.0/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+2.0*pow(p[7][0],2.0)*pow(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.16666666666666666*(2.0-p[22][0]/p[21][0])*(6.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],
+    d->fuu[9]=p[15][0]*((u[0]-x[3])*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(6.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(2.0*(u[0]-x[3])/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)-2.0/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+2.0*pow(p[7][0],2.0)*pow(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.16666666666666666*(2.0-p[22][0]/p[21][0])*(6.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],
      2.0)/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(2.0*(u[0]-x[3])/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)-2.0/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+2.0*pow(p[7][0],2.0)*pow(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))+0.08333333333333333*(2.0-p[22][0]/p[21][0])*pow(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+
      (u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/p[1][0]/p[21][0]/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5),1,-0.5*p[1][0]*p[22][0]*(6.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(2.0*(u[0]-x[3])/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)-2.0/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+2.0*pow(p[7][0],2.0)*pow(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6]
      [0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5)+0.75*p[1][0]*p[22][0]*pow(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),2.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-2.0*(u[0]-x[3])*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],
@@ -2311,9 +2679,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      [0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+2.0*(u[0]-x[3])*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3
      ]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)-2.0*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+
      0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/p[20][0];
-    if (isNANorINF(t->fuu[9]))
+    if (isNANorINF(d->fuu[9]))
         {
-            PRNT("    @k %d: t->fuu[9] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fuu[9]);
+            PRNT("    @k %d: d->fuu[9] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fuu[9]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -2331,7 +2699,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             return(0);
         }
 // j= 1
-    t->fuu[11]=p[15][0]*(2.0*p[6][0]*sin(u[1])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))
+    d->fuu[11]=p[15][0]*(2.0*p[6][0]*sin(u[1])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))
      ),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))+2.0*p[6][0]*cos(u[1])*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+
      p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[
      5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))+p[6][0]*sin(u[1])*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(mcond(x[3]>=0.0,-1.0,1,1.0),2.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4]
@@ -2342,9 +2710,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))-p[6][0]*sin(u[1])*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[
      22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))+2.0*p[6][0]*sin(u[1])*pow(mcond(x[3]>=0.0,-1.0,1,1.0),2.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[
      5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0];
-    if (isNANorINF(t->fuu[11]))
+    if (isNANorINF(d->fuu[11]))
         {
-            PRNT("    @k %d: t->fuu[11] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fuu[11]);
+            PRNT("    @k %d: d->fuu[11] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fuu[11]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -2362,16 +2730,16 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
         }
 // d^2f[4]/du[i] du[j]
 // j= 0
-    t->fuu[12]=p[15][0]*(-(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(6.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(2.0*(u[0]-x[3])/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)-2.0/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+2.0*pow(p[7][0],2.0)*pow(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.16666666666666666*(2.0-p[22][0]/p[21][0])*(6.0*pow(x[4]-x[5]*p[5][0],2.0)*pow
+    d->fuu[12]=p[15][0]*(-(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(6.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(2.0*(u[0]-x[3])/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)-2.0/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+2.0*pow(p[7][0],2.0)*pow(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.16666666666666666*(2.0-p[22][0]/p[21][0])*(6.0*pow(x[4]-x[5]*p[5][0],2.0)*pow
      (p[6][0],2.0)/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(2.0*(u[0]-x[3])/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)-2.0/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+2.0*pow(p[7][0],2.0)*pow(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))+0.08333333333333333*(2.0-p[22][0]/p[21][0])*pow(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0
      )+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/p[1][0]/p[21][0]/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5),1,-0.5*p[1][0]*p[22][0]*(6.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(2.0*(u[0]-x[3])/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)-2.0/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+2.0*pow(p[7][0],2.0)*pow(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)
      +pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5)+0.75*p[1][0]*p[22][0]*pow(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),2.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+2.0*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p
      [1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.16666666666666666*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[1][0]/p[21][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(
      0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-0.5*p[1][0]*p[22][0]*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-2.0*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0
      -0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0))/p[20][0];
-    if (isNANorINF(t->fuu[12]))
+    if (isNANorINF(d->fuu[12]))
         {
-            PRNT("    @k %d: t->fuu[12] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fuu[12]);
+            PRNT("    @k %d: d->fuu[12] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fuu[12]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -2389,7 +2757,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             return(0);
         }
 // j= 1
-    t->fuu[14]=p[15][0]*(-2.0*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))
+    d->fuu[14]=p[15][0]*(-2.0*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))
      )),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))+2.0*p[6][0]*sin(u[1])*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]
      +p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x
      [5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))-p[6][0]*cos(u[1])*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(mcond(x[3]>=0.0,-1.0,1,1.0),2.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4
@@ -2400,9 +2768,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))+p[6][0]*cos(u[1])*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[
      22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))-2.0*p[6][0]*cos(u[1])*pow(mcond(x[3]>=0.0,-1.0,1,1.0),2.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[
      5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0];
-    if (isNANorINF(t->fuu[14]))
+    if (isNANorINF(d->fuu[14]))
         {
-            PRNT("    @k %d: t->fuu[14] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fuu[14]);
+            PRNT("    @k %d: d->fuu[14] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fuu[14]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -2420,16 +2788,16 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
         }
 // d^2f[5]/du[i] du[j]
 // j= 0
-    t->fuu[15]=p[15][0]*(p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(6.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(2.0*(u[0]-x[3])/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)-2.0/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+2.0*pow(p[7][0],2.0)*pow(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.16666666666666666*(2.0-p[22][0]/p[21][0])*(6.0*pow(x[4]-x[5]*p[5][0],
+    d->fuu[15]=p[15][0]*(p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(6.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(2.0*(u[0]-x[3])/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)-2.0/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+2.0*pow(p[7][0],2.0)*pow(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.16666666666666666*(2.0-p[22][0]/p[21][0])*(6.0*pow(x[4]-x[5]*p[5][0],
      2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(2.0*(u[0]-x[3])/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)-2.0/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+2.0*pow(p[7][0],2.0)*pow(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))+0.08333333333333333*(2.0-p[22][0]/p[21][0])*pow(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[
      3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/p[1][0]/p[21][0]/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5),1,-0.5*p[1][0]*p[22][0]*(6.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(2.0*(u[0]-x[3])/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)-2.0/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+2.0*pow(p[7][0],2.0)*pow(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[
      3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5)+0.75*p[1][0]*p[22][0]*pow(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),2.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-2.0*p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[
      3]),2.0))<=3.0*p[1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.16666666666666666*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[1][0]/p[21][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(
      u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-0.5*p[1][0]*p[22][0]*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+2.0*p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+
      0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0))/p[2][0];
-    if (isNANorINF(t->fuu[15]))
+    if (isNANorINF(d->fuu[15]))
         {
-            PRNT("    @k %d: t->fuu[15] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fuu[15]);
+            PRNT("    @k %d: d->fuu[15] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fuu[15]);
             {
                 PRNT("        p[2,0]= %g\n",p[2][0]);
                 PRNT("        p[15,0]= %g\n",p[15][0]);
@@ -2447,7 +2815,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             return(0);
         }
 // j= 1
-    t->fuu[17]=p[15][0]*(-2.0*p[4][0]*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs
+    d->fuu[17]=p[15][0]*(-2.0*p[4][0]*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs
      (x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))+2.0*p[4][0]*p[6][0]*sin(u[1])*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,
      -u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan
      ((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))-p[4][0]*p[6][0]*cos(u[1])*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(mcond(x[3]>=0.0,-1.0,1,1.0),2.0)*pow(sec(mcond(x[3]>=
@@ -2458,9 +2826,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))+p[4][0]*p[6][0]*cos(u[1])*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[
      21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))-2.0*p[4][0]*p[6][0]*cos(u[1])*pow(mcond(x[3]>=0.0,-1.0,1,1.0),2.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(
      tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[2][0];
-    if (isNANorINF(t->fuu[17]))
+    if (isNANorINF(d->fuu[17]))
         {
-            PRNT("    @k %d: t->fuu[17] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fuu[17]);
+            PRNT("    @k %d: d->fuu[17] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fuu[17]);
             {
                 PRNT("        p[2,0]= %g\n",p[2][0]);
                 PRNT("        p[15,0]= %g\n",p[15][0]);
@@ -2500,7 +2868,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
 // j= 1
 // d^2f[3]/dx[i] du[j]
 // j= 0
-    t->fxu[63]=p[15][0]*(-p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.16666666666666666*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[
+    d->fxu[63]=p[15][0]*(-p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.16666666666666666*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[
      3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[1][0]/p[21][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-0.5*p[1][0]*p[22][0]*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-(u[0]-x[3])*p[7][0]*mcond(x[3]>0.0,1.0,1,-1.0)*mcond(sqrt(pow(p[7][0],2.0)*
      pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.16666666666666666*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+
      abs(x[3]))))/p[1][0]/p[21][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-0.5*p[1][0]*p[22][0]*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-(u[0]-x[3])*p[7][0]*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))*mcond(sqrt(pow(p[7
@@ -2527,9 +2895,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-1/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-(u[0]-x[3])*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),2.5)-0.5*p[1][0]*p[22][0]*(6.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)-4.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),3.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+6.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[
      3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(1/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+2.0*(u[0]-x[3])*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)-(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+2.0*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))*(-1/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-(u[0]-x[3])*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/pow(
      0.001+abs(x[3]),2.0))/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[20][0];
-    if (isNANorINF(t->fxu[63]))
+    if (isNANorINF(d->fxu[63]))
         {
-            PRNT("    @k %d: t->fxu[63] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxu[63]);
+            PRNT("    @k %d: d->fxu[63] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxu[63]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -2546,15 +2914,15 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxu[64]=p[15][0]*((u[0]-x[3])*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.4444444444444444*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+0.16666666666666666*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0
+    d->fxu[64]=p[15][0]*((u[0]-x[3])*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.4444444444444444*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+0.16666666666666666*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0
      )*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5)+0.6666666666666666*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,1.5*p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u
      [0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),2.5)+2.0*p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-(u[0]-x[3])*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[
      21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(
      0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][
      0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[20][0];
-    if (isNANorINF(t->fxu[64]))
+    if (isNANorINF(d->fxu[64]))
         {
-            PRNT("    @k %d: t->fxu[64] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxu[64]);
+            PRNT("    @k %d: d->fxu[64] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxu[64]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -2571,15 +2939,15 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxu[65]=p[15][0]*((u[0]-x[3])*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.4444444444444444*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)-0.16666666666666666*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(
+    d->fxu[65]=p[15][0]*((u[0]-x[3])*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.4444444444444444*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)-0.16666666666666666*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(
      pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5)-0.6666666666666666*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-1.5*p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow
      (0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),2.5)-2.0*p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-(u[0]-x[3])*p[7][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*(x[4]-x[5]*p[5][0])*pow
      (p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+p[7][0]*mcond(sqrt(pow(p[7][0],2.0
      )*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])
      /(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[20][0];
-    if (isNANorINF(t->fxu[65]))
+    if (isNANorINF(d->fxu[65]))
         {
-            PRNT("    @k %d: t->fxu[65] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxu[65]);
+            PRNT("    @k %d: d->fxu[65] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxu[65]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -2597,7 +2965,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             return(0);
         }
 // j= 1
-    t->fxu[73]=p[15][0]*(p[6][0]*sin(u[1])*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))
+    d->fxu[73]=p[15][0]*(p[6][0]*sin(u[1])*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))
      /pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5
      ])/(0.001+abs(x[3]))))),2.0),1.5))+p[6][0]*sin(u[1])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(
      0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(
@@ -2613,9 +2981,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))+p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0
      -p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))+2.0*p[6][0]*sin(u[1])*mcond(x[3]>=0.0,-1.0,1,1.0)*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(
      x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0];
-    if (isNANorINF(t->fxu[73]))
+    if (isNANorINF(d->fxu[73]))
         {
-            PRNT("    @k %d: t->fxu[73] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxu[73]);
+            PRNT("    @k %d: d->fxu[73] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxu[73]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -2631,7 +2999,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxu[74]=p[15][0]*(p[6][0]*sin(u[1])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]
+    d->fxu[74]=p[15][0]*(p[6][0]*sin(u[1])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]
      >=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))+p[6][0]*sin(u[1])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-
      u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(
      0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(
@@ -2645,9 +3013,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      ,1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))+p[6][0]*cos(u[1])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0
      *p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))+2.0*p[6][0]*sin(u[1])*mcond(x[3]>=0.0,-1.0,1,1.0)*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001
      +abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0];
-    if (isNANorINF(t->fxu[74]))
+    if (isNANorINF(d->fxu[74]))
         {
-            PRNT("    @k %d: t->fxu[74] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxu[74]);
+            PRNT("    @k %d: d->fxu[74] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxu[74]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -2663,7 +3031,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxu[75]=p[15][0]*(p[6][0]*sin(u[1])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0]
+    d->fxu[75]=p[15][0]*(p[6][0]*sin(u[1])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0]
      )*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))+p[6][0]*sin(u[1])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond
      (x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow
      (0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/
@@ -2678,9 +3046,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      )/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))+2.0*p[6][0]*sin(u[1])*mcond(x[3]>=0.0,-1.0,1,1.0)*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),
      2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0]
      ,1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0];
-    if (isNANorINF(t->fxu[75]))
+    if (isNANorINF(d->fxu[75]))
         {
-            PRNT("    @k %d: t->fxu[75] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxu[75]);
+            PRNT("    @k %d: d->fxu[75] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxu[75]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -2698,7 +3066,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
         }
 // d^2f[4]/dx[i] du[j]
 // j= 0
-    t->fxu[83]=p[15][0]*((x[4]-x[5]*p[5][0])*p[6][0]*mcond(x[3]>0.0,1.0,1,-1.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.16666666666666666*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+
+    d->fxu[83]=p[15][0]*((x[4]-x[5]*p[5][0])*p[6][0]*mcond(x[3]>0.0,1.0,1,-1.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.16666666666666666*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+
      abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[1][0]/p[21][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-0.5*p[1][0]*p[22][0]*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+(x[4]-x[5]*p[5][0])*p
      [6][0]*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.16666666666666666*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u
      [0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[1][0]/p[21][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-0.5*p[1][0]*p[22][0]*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-2.0*
@@ -2716,9 +3084,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),3.0)-2.0*pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),3.0)-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-1/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-(u[0]-x[3])*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),2.5)-0.5*p[1][0]*p[22][0]*(6.0*pow(x[4]-x[5]
      *p[5][0],2.0)*pow(p[6][0],2.0)*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)-4.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),3.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+6.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(1/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+2.0*(u[0]-x[3])*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)-(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/
      pow(0.001+abs(x[3]),2.0))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+2.0*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))*(-1/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-(u[0]-x[3])*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/pow(0.001+abs(x[3]),2.0))/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[20][0];
-    if (isNANorINF(t->fxu[83]))
+    if (isNANorINF(d->fxu[83]))
         {
-            PRNT("    @k %d: t->fxu[83] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxu[83]);
+            PRNT("    @k %d: d->fxu[83] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxu[83]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -2735,16 +3103,16 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxu[84]=p[15][0]*(-(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.4444444444444444*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+0.16666666666666666*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[
+    d->fxu[84]=p[15][0]*(-(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.4444444444444444*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+0.16666666666666666*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[
      7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5)+0.6666666666666666*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,1.5*p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/
      pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),2.5)+2.0*p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0
      -0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3]
      )/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.16666666666666666*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[1][0]/p[21][0]/
      sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-0.5*p[1][0]*p[22][0]*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(
      1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/p[20][0];
-    if (isNANorINF(t->fxu[84]))
+    if (isNANorINF(d->fxu[84]))
         {
-            PRNT("    @k %d: t->fxu[84] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxu[84]);
+            PRNT("    @k %d: d->fxu[84] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxu[84]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -2761,7 +3129,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxu[85]=p[15][0]*(-(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.4444444444444444*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)-0.16666666666666666*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),
+    d->fxu[85]=p[15][0]*(-(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.4444444444444444*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)-0.16666666666666666*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),
      2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5)-0.6666666666666666*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-1.5*p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3
      ]))))/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),2.5)-2.0*p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.2222222222222222*p[5][0]*(x[4]-
      x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+p[5][0]*p[6][0]*
@@ -2769,9 +3137,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[1][0]/p[21][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-0.5*p[1][0]*p[22][0]*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-p[5][0]*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/
      pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/pow(0.001+abs(x[3]),2.0)/
      pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/p[20][0];
-    if (isNANorINF(t->fxu[85]))
+    if (isNANorINF(d->fxu[85]))
         {
-            PRNT("    @k %d: t->fxu[85] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxu[85]);
+            PRNT("    @k %d: d->fxu[85] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxu[85]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -2789,7 +3157,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             return(0);
         }
 // j= 1
-    t->fxu[93]=p[15][0]*(-p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))
+    d->fxu[93]=p[15][0]*(-p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))
      )/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[
      5])/(0.001+abs(x[3]))))),2.0),1.5))-p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(
      0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(
@@ -2805,9 +3173,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))+p[6][0]*sin(u[1])*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0
      -p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))-2.0*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-1.0,1,1.0)*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(
      x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0];
-    if (isNANorINF(t->fxu[93]))
+    if (isNANorINF(d->fxu[93]))
         {
-            PRNT("    @k %d: t->fxu[93] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxu[93]);
+            PRNT("    @k %d: d->fxu[93] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxu[93]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -2823,7 +3191,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxu[94]=p[15][0]*(-p[6][0]*cos(u[1])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3
+    d->fxu[94]=p[15][0]*(-p[6][0]*cos(u[1])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3
      ]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))-p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,
      -u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(
      0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(
@@ -2837,9 +3205,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      ,1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))+p[6][0]*sin(u[1])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0
      *p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))-2.0*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-1.0,1,1.0)*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001
      +abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0];
-    if (isNANorINF(t->fxu[94]))
+    if (isNANorINF(d->fxu[94]))
         {
-            PRNT("    @k %d: t->fxu[94] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxu[94]);
+            PRNT("    @k %d: d->fxu[94] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxu[94]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -2855,7 +3223,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxu[95]=p[15][0]*(-p[6][0]*cos(u[1])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0
+    d->fxu[95]=p[15][0]*(-p[6][0]*cos(u[1])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0
      ])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))-p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(
      mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0
      )/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x
@@ -2870,9 +3238,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))-2.0*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-1.0,1,1.0)*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[
      3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21
      ][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[20][0];
-    if (isNANorINF(t->fxu[95]))
+    if (isNANorINF(d->fxu[95]))
         {
-            PRNT("    @k %d: t->fxu[95] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxu[95]);
+            PRNT("    @k %d: d->fxu[95] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxu[95]);
             {
                 PRNT("        p[15,0]= %g\n",p[15][0]);
                 PRNT("        p[20,0]= %g\n",p[20][0]);
@@ -2890,7 +3258,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
         }
 // d^2f[5]/dx[i] du[j]
 // j= 0
-    t->fxu[103]=p[15][0]*(-p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(x[3]>0.0,1.0,1,-1.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.16666666666666666*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])
+    d->fxu[103]=p[15][0]*(-p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(x[3]>0.0,1.0,1,-1.0)*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.16666666666666666*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])
      /(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[1][0]/p[21][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-0.5*p[1][0]*p[22][0]*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-p[5][0]*(x[4]
      -x[5]*p[5][0])*p[6][0]*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.16666666666666666*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x
      [3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[1][0]/p[21][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-0.5*p[1][0]*p[22][0]*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(
@@ -2908,9 +3276,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      (1.0+(u[0]-x[3])/(0.001+abs(x[3]))))*(-2.0*pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),3.0)-2.0*pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),3.0)-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-1/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-(u[0]-x[3])*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),
      2.0),2.5)-0.5*p[1][0]*p[22][0]*(6.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),4.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)-4.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),3.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+6.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),4.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(1/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+2.0*(u[0]-x[3])*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)-(-1/(0.001+abs
      (x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+2.0*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))*(-1/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-(u[0]-x[3])*(-1/(0.001+abs(x[3]))-(u[0]-x[3])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/pow(0.001+abs(x[3]),2.0))/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[2][0];
-    if (isNANorINF(t->fxu[103]))
+    if (isNANorINF(d->fxu[103]))
         {
-            PRNT("    @k %d: t->fxu[103] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxu[103]);
+            PRNT("    @k %d: d->fxu[103] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxu[103]);
             {
                 PRNT("        p[2,0]= %g\n",p[2][0]);
                 PRNT("        p[15,0]= %g\n",p[15][0]);
@@ -2927,7 +3295,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxu[104]=p[15][0]*(p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.4444444444444444*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+0.16666666666666666*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/
+    d->fxu[104]=p[15][0]*(p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],-0.4444444444444444*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+0.16666666666666666*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/
      pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5)+0.6666666666666666*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,1.5*p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[
      3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),2.5)+2.0*p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.2222222222222222*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*
      (1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)-0.3333333333333333*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-p[1][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+p[5][0]*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(
@@ -2935,9 +3303,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      0]/p[21][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-0.5*p[1][0]*p[22][0]*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-p[5][0]*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[
      4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)))/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/p[2][0]
      ;
-    if (isNANorINF(t->fxu[104]))
+    if (isNANorINF(d->fxu[104]))
         {
-            PRNT("    @k %d: t->fxu[104] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxu[104]);
+            PRNT("    @k %d: d->fxu[104] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxu[104]);
             {
                 PRNT("        p[2,0]= %g\n",p[2][0]);
                 PRNT("        p[15,0]= %g\n",p[15][0]);
@@ -2954,7 +3322,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxu[105]=p[15][0]*(p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.4444444444444444*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)-0.16666666666666666*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs
+    d->fxu[105]=p[15][0]*(p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],0.4444444444444444*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)-0.16666666666666666*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs
      (x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5)-0.6666666666666666*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-1.5*p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001
      +abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),2.5)-2.0*p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))-p[5][0]*(x[4]-x[5]*p[5][0])*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],
      -0.2222222222222222*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])/pow(p[1][0],2.0)/pow(p[21][0],2.0)/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+0.3333333333333333*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])/p[1][0]/p[21][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,p[1][0]*p[5][0]*(x[4]-x[5]*p[5][0])*pow(p[6][0],2.0)*p[22][0]/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001
@@ -2962,9 +3330,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      (0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/p[1][0]/p[21][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)),1,-0.5*p[1][0]*p[22][0]*(-2.0*pow(x[4]-x[5]*p[5][0],2.0)*pow(p[6][0],2.0)/pow(0.001+abs(x[3]),3.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),3.0)+2.0*(u[0]-x[3])*pow(p[7][0],2.0)*(-(u[0]-x[3])/(0.001+abs(x[3]))/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0)+1/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(0.001+abs(x[3]),2.0)/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))))/pow(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0),1.5))/(0.001+abs(x[3]))/(1.0+(u[0]-x[3])/(0.001+abs(x[3])))+pow(p[5][0],2.0)*p[6][0]*mcond(sqrt(pow(p[7][0],2.0)*pow((u[0]-
      x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))<=3.0*p[1][0]*p[21][0],1.0+0.1111111111111111*(1.0-0.6666666666666666*p[22][0]/p[21][0])*(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/pow(p[1][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0))/p[1][0]/p[21][0],1,p[1][0]*p[22][0]/sqrt(pow(p[7][0],2.0)*pow((u[0]-x[3])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(0.001+abs(x[3]),2.0)+pow(p[6][0],2.0)*pow((x[4]-x[5]*p[5][0])/(1.0+(u[0]-x[3])/(0.001+abs(x[3]))),2.0)/pow(
      0.001+abs(x[3]),2.0)))/pow(0.001+abs(x[3]),2.0)/pow(1.0+(u[0]-x[3])/(0.001+abs(x[3])),2.0))/p[2][0];
-    if (isNANorINF(t->fxu[105]))
+    if (isNANorINF(d->fxu[105]))
         {
-            PRNT("    @k %d: t->fxu[105] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxu[105]);
+            PRNT("    @k %d: d->fxu[105] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxu[105]);
             {
                 PRNT("        p[2,0]= %g\n",p[2][0]);
                 PRNT("        p[15,0]= %g\n",p[15][0]);
@@ -2982,7 +3350,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             return(0);
         }
 // j= 1
-    t->fxu[113]=p[15][0]*(-p[4][0]*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs
+    d->fxu[113]=p[15][0]*(-p[4][0]*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs
      (x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p
      [4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))-p[4][0]*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p
      [4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/
@@ -2998,9 +3366,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      (tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))+p[4][0]*p[6][0]*sin(u[1])*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[
      21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))-2.0*p[4][0]*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-1.0,1,1.0)*mcond(x[3]>=0.0,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,-(x[4]+p[4][0]*x[5])*mcond(x[3]>0.0,1.0,1,-1.0)/pow(0.001+abs(x[3]),2.0)/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))
      *mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[2][0];
-    if (isNANorINF(t->fxu[113]))
+    if (isNANorINF(d->fxu[113]))
         {
-            PRNT("    @k %d: t->fxu[113] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxu[113]);
+            PRNT("    @k %d: d->fxu[113] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxu[113]);
             {
                 PRNT("        p[2,0]= %g\n",p[2][0]);
                 PRNT("        p[15,0]= %g\n",p[15][0]);
@@ -3016,7 +3384,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxu[114]=p[15][0]*(-p[4][0]*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*
+    d->fxu[114]=p[15][0]*(-p[4][0]*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*
      mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))-p[4][0]*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec
      (mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x
      [3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p
@@ -3031,9 +3399,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))-2.0*p[4][0]*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-1.0,1,1.0)*mcond(x[3]>=0.0,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,1/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+
      abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+
      abs(x[3]))))),2.0))))/p[2][0];
-    if (isNANorINF(t->fxu[114]))
+    if (isNANorINF(d->fxu[114]))
         {
-            PRNT("    @k %d: t->fxu[114] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxu[114]);
+            PRNT("    @k %d: d->fxu[114] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxu[114]);
             {
                 PRNT("        p[2,0]= %g\n",p[2][0]);
                 PRNT("        p[15,0]= %g\n",p[15][0]);
@@ -3049,7 +3417,7 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->fxu[115]=p[15][0]*(-p[4][0]*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0
+    d->fxu[115]=p[15][0]*(-p[4][0]*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0
      ]/p[21][0])*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,-1.0,1,1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0),1.5))-p[4][0]*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-1.0,1,
      1.0)*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],0.2222222222222222*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*pow(p[6][0],2.0)*(2.0-p[22][0]/p[21][0])*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4
      ][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))/p[0][0]/p[21][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)),1,-p[0][0]*pow(p[6][0],2.0)*p[22][0]*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x
@@ -3064,9 +3432,9 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
      abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)))-2.0*p[4][0]*p[6][0]*cos(u[1])*mcond(x[3]>=0.0,-1.0,1,1.0)*mcond(x[3]>=0.0,p[4][0]/(0.001+abs(x[3]))/(
      1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)),1,p[4][0]/(0.001+abs(x[3]))/(1.0+pow(x[4]+p[4][0]*x[5],2.0)/pow(0.001+abs(x[3]),2.0)))*pow(sec(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)*tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3])))))*mcond(sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))<=3.0*p[0][0]*p[21][0],1.0+0.1111111111111111*pow(p[6][0],2.0)*(1.0-0.6666666666666666*p[22][0]/p[21][0])*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0)/pow(p[0][0],2.0)/pow(p[21][0],2.0)-0.3333333333333333*(2.0-p[22][0]/p[21][0])*sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0
      ]*x[5])/(0.001+abs(x[3]))))),2.0))/p[0][0]/p[21][0],1,p[0][0]*p[22][0]/sqrt(pow(p[6][0],2.0)*pow(tan(mcond(x[3]>=0.0,-u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))),1,u[1]+atan((x[4]+p[4][0]*x[5])/(0.001+abs(x[3]))))),2.0))))/p[2][0];
-    if (isNANorINF(t->fxu[115]))
+    if (isNANorINF(d->fxu[115]))
         {
-            PRNT("    @k %d: t->fxu[115] in line %d is nan or inf: %g\n", k, __LINE__-3,t->fxu[115]);
+            PRNT("    @k %d: d->fxu[115] in line %d is nan or inf: %g\n", k, __LINE__-3,d->fxu[115]);
             {
                 PRNT("        p[2,0]= %g\n",p[2][0]);
                 PRNT("        p[15,0]= %g\n",p[15][0]);
@@ -3097,50 +3465,42 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
 #endif
 
 // derivatives of L
-    t->cx[0]=p[13][0]*(x[0]-p[25][0])/sqrt(pow(p[24][0],2.0)+pow(x[0]-p[25][0],2.0))+p[16][0]*mcond(sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))>p[14][0],0.0,1,-2.0*(x[0]-p[3][0])*(1/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))-1/p[14][0])/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),1.5))+p[17][0]*mcond(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4]<0.0,0.0,1,x[3]/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))-(x[0]-p[3][0])*(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4])/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),1.5)/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0)));
-    if (isNANorINF(t->cx[0]))
+    d->cx[0]=p[13][0]*(x[0]-p[25][0])/sqrt(pow(p[24][0],2.0)+pow(x[0]-p[25][0],2.0));
+    if (isNANorINF(d->cx[0]))
         {
-            PRNT("    @k %d: t->cx[0] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cx[0]);
+            PRNT("    @k %d: d->cx[0] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cx[0]);
             {
                 PRNT("        p[13,0]= %g\n",p[13][0]);
                 PRNT("        p[25,0]= %g\n",p[25][0]);
                 PRNT("        x[0]= %g\n",x[0]);
                 PRNT("        p[24,0]= %g\n",p[24][0]);
-                PRNT("        p[17,0]= %g\n",p[17][0]);
                 PRNT("        x[3]= %g\n",x[3]);
-                PRNT("        p[3,0]= %g\n",p[3][0]);
                 PRNT("        x[4]= %g\n",x[4]);
-                PRNT("        p[3,1]= %g\n",p[3][1]);
                 PRNT("        x[1]= %g\n",x[1]);
-                PRNT("        p[16,0]= %g\n",p[16][0]);
                 PRNT("        p[14,0]= %g\n",p[14][0]);
             }
             return(0);
         }
-    t->cx[1]=p[13][1]*(x[1]-p[25][1])/sqrt(pow(p[24][1],2.0)+pow(x[1]-p[25][1],2.0))+p[16][0]*mcond(sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))>p[14][0],0.0,1,-2.0*(x[1]-p[3][1])*(1/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))-1/p[14][0])/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),1.5))+p[17][0]*mcond(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4]<0.0,0.0,1,x[4]/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))-(x[1]-p[3][1])*(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4])/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),1.5)/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0)));
-    if (isNANorINF(t->cx[1]))
+    d->cx[1]=p[13][1]*(x[1]-p[25][1])/sqrt(pow(p[24][1],2.0)+pow(x[1]-p[25][1],2.0));
+    if (isNANorINF(d->cx[1]))
         {
-            PRNT("    @k %d: t->cx[1] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cx[1]);
+            PRNT("    @k %d: d->cx[1] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cx[1]);
             {
                 PRNT("        p[13,1]= %g\n",p[13][1]);
                 PRNT("        p[25,1]= %g\n",p[25][1]);
                 PRNT("        x[1]= %g\n",x[1]);
                 PRNT("        p[24,1]= %g\n",p[24][1]);
-                PRNT("        p[17,0]= %g\n",p[17][0]);
                 PRNT("        x[3]= %g\n",x[3]);
-                PRNT("        p[3,0]= %g\n",p[3][0]);
                 PRNT("        x[0]= %g\n",x[0]);
                 PRNT("        x[4]= %g\n",x[4]);
-                PRNT("        p[3,1]= %g\n",p[3][1]);
-                PRNT("        p[16,0]= %g\n",p[16][0]);
                 PRNT("        p[14,0]= %g\n",p[14][0]);
             }
             return(0);
         }
-    t->cx[2]=p[13][2]*(x[2]-p[25][2])/sqrt(pow(p[24][2],2.0)+pow(x[2]-p[25][2],2.0));
-    if (isNANorINF(t->cx[2]))
+    d->cx[2]=p[13][2]*(x[2]-p[25][2])/sqrt(pow(p[24][2],2.0)+pow(x[2]-p[25][2],2.0));
+    if (isNANorINF(d->cx[2]))
         {
-            PRNT("    @k %d: t->cx[2] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cx[2]);
+            PRNT("    @k %d: d->cx[2] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cx[2]);
             {
                 PRNT("        p[13,2]= %g\n",p[13][2]);
                 PRNT("        p[25,2]= %g\n",p[25][2]);
@@ -3149,47 +3509,41 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->cx[3]=x[3]*p[8][0]/sqrt(1.0+pow(x[3],2.0))+p[10][0]*(x[3]-p[25][3])/sqrt(pow(p[24][0],2.0)+pow(x[3]-p[25][3],2.0))+p[17][0]*mcond(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4]<0.0,0.0,1,-x[3]*(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4])/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),1.5)+(x[0]-p[3][0])/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0)));
-    if (isNANorINF(t->cx[3]))
+    d->cx[3]=x[3]*p[8][0]/sqrt(1.0+pow(x[3],2.0))+p[10][0]*(x[3]-p[25][3])/sqrt(pow(p[24][0],2.0)+pow(x[3]-p[25][3],2.0));
+    if (isNANorINF(d->cx[3]))
         {
-            PRNT("    @k %d: t->cx[3] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cx[3]);
+            PRNT("    @k %d: d->cx[3] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cx[3]);
             {
                 PRNT("        p[10,0]= %g\n",p[10][0]);
                 PRNT("        p[25,3]= %g\n",p[25][3]);
                 PRNT("        x[3]= %g\n",x[3]);
                 PRNT("        p[24,0]= %g\n",p[24][0]);
                 PRNT("        p[8,0]= %g\n",p[8][0]);
-                PRNT("        p[17,0]= %g\n",p[17][0]);
-                PRNT("        p[3,0]= %g\n",p[3][0]);
                 PRNT("        x[0]= %g\n",x[0]);
                 PRNT("        x[4]= %g\n",x[4]);
-                PRNT("        p[3,1]= %g\n",p[3][1]);
                 PRNT("        x[1]= %g\n",x[1]);
             }
             return(0);
         }
-    t->cx[4]=p[10][1]*(x[4]-p[25][4])/sqrt(pow(p[24][1],2.0)+pow(x[4]-p[25][4],2.0))+p[17][0]*mcond(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4]<0.0,0.0,1,-x[4]*(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4])/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),1.5)+(x[1]-p[3][1])/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0)));
-    if (isNANorINF(t->cx[4]))
+    d->cx[4]=p[10][1]*(x[4]-p[25][4])/sqrt(pow(p[24][1],2.0)+pow(x[4]-p[25][4],2.0));
+    if (isNANorINF(d->cx[4]))
         {
-            PRNT("    @k %d: t->cx[4] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cx[4]);
+            PRNT("    @k %d: d->cx[4] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cx[4]);
             {
                 PRNT("        p[10,1]= %g\n",p[10][1]);
                 PRNT("        p[25,4]= %g\n",p[25][4]);
                 PRNT("        x[4]= %g\n",x[4]);
                 PRNT("        p[24,1]= %g\n",p[24][1]);
-                PRNT("        p[17,0]= %g\n",p[17][0]);
                 PRNT("        x[3]= %g\n",x[3]);
-                PRNT("        p[3,0]= %g\n",p[3][0]);
                 PRNT("        x[0]= %g\n",x[0]);
-                PRNT("        p[3,1]= %g\n",p[3][1]);
                 PRNT("        x[1]= %g\n",x[1]);
             }
             return(0);
         }
-    t->cx[5]=p[10][2]*(x[5]-p[25][5])/sqrt(pow(p[24][2],2.0)+pow(x[5]-p[25][5],2.0));
-    if (isNANorINF(t->cx[5]))
+    d->cx[5]=p[10][2]*(x[5]-p[25][5])/sqrt(pow(p[24][2],2.0)+pow(x[5]-p[25][5],2.0));
+    if (isNANorINF(d->cx[5]))
         {
-            PRNT("    @k %d: t->cx[5] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cx[5]);
+            PRNT("    @k %d: d->cx[5] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cx[5]);
             {
                 PRNT("        p[10,2]= %g\n",p[10][2]);
                 PRNT("        p[25,5]= %g\n",p[25][5]);
@@ -3198,22 +3552,22 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->cx[6]=0.0;
-    t->cx[7]=0.0;
-    t->cx[8]=2.0*x[8]*p[9][0];
-    if (isNANorINF(t->cx[8]))
+    d->cx[6]=0.0;
+    d->cx[7]=0.0;
+    d->cx[8]=2.0*x[8]*p[9][0];
+    if (isNANorINF(d->cx[8]))
         {
-            PRNT("    @k %d: t->cx[8] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cx[8]);
+            PRNT("    @k %d: d->cx[8] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cx[8]);
             {
                 PRNT("        p[9,0]= %g\n",p[9][0]);
                 PRNT("        x[8]= %g\n",x[8]);
             }
             return(0);
         }
-    t->cx[9]=2.0*x[9]*p[9][1];
-    if (isNANorINF(t->cx[9]))
+    d->cx[9]=2.0*x[9]*p[9][1];
+    if (isNANorINF(d->cx[9]))
         {
-            PRNT("    @k %d: t->cx[9] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cx[9]);
+            PRNT("    @k %d: d->cx[9] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cx[9]);
             {
                 PRNT("        p[9,1]= %g\n",p[9][1]);
                 PRNT("        x[9]= %g\n",x[9]);
@@ -3221,71 +3575,57 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             return(0);
         }
 
-    t->cxx[0]=p[13][0]/sqrt(pow(p[24][0],2.0)+pow(x[0]-p[25][0],2.0))-p[13][0]*pow(x[0]-p[25][0],2.0)/pow(pow(p[24][0],2.0)+pow(x[0]-p[25][0],2.0),1.5)+p[16][0]*mcond(sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))>p[14][0],0.0,1,2.0*pow(x[0]-p[3][0],2.0)/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),3.0)+6.0*pow(x[0]-p[3][0],2.0)*(1/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))-1/p[14][0])/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),2.5)-2.0*(1/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))-1/p[14][0])/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),1.5))+p[17][0]*mcond(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4]<0.0,0.0,1,-2.0*x[3]*(x[0]-p[3][0])/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),1.5)/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))+3.0*pow(x[0]-p[3][0],2.0)*(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4])/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),2.5)/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))-(x[3]*(x[0]-p[3][0])+(x[1]-p[3
-     ][1])*x[4])/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),1.5)/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0)));
-    if (isNANorINF(t->cxx[0]))
+    d->cxx[0]=p[13][0]/sqrt(pow(p[24][0],2.0)+pow(x[0]-p[25][0],2.0))-p[13][0]*pow(x[0]-p[25][0],2.0)/pow(pow(p[24][0],2.0)+pow(x[0]-p[25][0],2.0),1.5);
+    if (isNANorINF(d->cxx[0]))
         {
-            PRNT("    @k %d: t->cxx[0] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cxx[0]);
+            PRNT("    @k %d: d->cxx[0] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cxx[0]);
             {
                 PRNT("        p[13,0]= %g\n",p[13][0]);
                 PRNT("        p[25,0]= %g\n",p[25][0]);
                 PRNT("        x[0]= %g\n",x[0]);
                 PRNT("        p[24,0]= %g\n",p[24][0]);
-                PRNT("        p[17,0]= %g\n",p[17][0]);
                 PRNT("        x[3]= %g\n",x[3]);
-                PRNT("        p[3,0]= %g\n",p[3][0]);
                 PRNT("        x[4]= %g\n",x[4]);
-                PRNT("        p[3,1]= %g\n",p[3][1]);
                 PRNT("        x[1]= %g\n",x[1]);
-                PRNT("        p[16,0]= %g\n",p[16][0]);
                 PRNT("        p[14,0]= %g\n",p[14][0]);
             }
             return(0);
         }
-    t->cxx[1]=p[16][0]*mcond(sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))>p[14][0],0.0,1,2.0*(x[0]-p[3][0])*(x[1]-p[3][1])/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),3.0)+6.0*(x[0]-p[3][0])*(x[1]-p[3][1])*(1/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))-1/p[14][0])/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),2.5))+p[17][0]*mcond(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4]<0.0,0.0,1,-x[3]*(x[1]-p[3][1])/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),1.5)/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))-(x[0]-p[3][0])*x[4]/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),1.5)/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))+3.0*(x[0]-p[3][0])*(x[1]-p[3][1])*(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4])/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),2.5)/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0)));
-    if (isNANorINF(t->cxx[1]))
+    d->cxx[1]=0.0;
+    if (isNANorINF(d->cxx[1]))
         {
-            PRNT("    @k %d: t->cxx[1] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cxx[1]);
+            PRNT("    @k %d: d->cxx[1] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cxx[1]);
             {
-                PRNT("        p[17,0]= %g\n",p[17][0]);
                 PRNT("        x[3]= %g\n",x[3]);
-                PRNT("        p[3,0]= %g\n",p[3][0]);
                 PRNT("        x[0]= %g\n",x[0]);
                 PRNT("        x[4]= %g\n",x[4]);
-                PRNT("        p[3,1]= %g\n",p[3][1]);
                 PRNT("        x[1]= %g\n",x[1]);
-                PRNT("        p[16,0]= %g\n",p[16][0]);
                 PRNT("        p[14,0]= %g\n",p[14][0]);
             }
             return(0);
         }
-    t->cxx[2]=p[13][1]/sqrt(pow(p[24][1],2.0)+pow(x[1]-p[25][1],2.0))-p[13][1]*pow(x[1]-p[25][1],2.0)/pow(pow(p[24][1],2.0)+pow(x[1]-p[25][1],2.0),1.5)+p[16][0]*mcond(sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))>p[14][0],0.0,1,2.0*pow(x[1]-p[3][1],2.0)/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),3.0)-2.0*(1/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))-1/p[14][0])/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),1.5)+6.0*pow(x[1]-p[3][1],2.0)*(1/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))-1/p[14][0])/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),2.5))+p[17][0]*mcond(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4]<0.0,0.0,1,-2.0*(x[1]-p[3][1])*x[4]/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),1.5)/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))-(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4])/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),1.5)/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))+3.0*pow(x[1]-p[3][1],2.0)*(x[3]*(x[0]-p[3][0])+(x[1]-p[3
-     ][1])*x[4])/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),2.5)/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0)));
-    if (isNANorINF(t->cxx[2]))
+    d->cxx[2]=p[13][1]/sqrt(pow(p[24][1],2.0)+pow(x[1]-p[25][1],2.0))-p[13][1]*pow(x[1]-p[25][1],2.0)/pow(pow(p[24][1],2.0)+pow(x[1]-p[25][1],2.0),1.5);
+    if (isNANorINF(d->cxx[2]))
         {
-            PRNT("    @k %d: t->cxx[2] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cxx[2]);
+            PRNT("    @k %d: d->cxx[2] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cxx[2]);
             {
                 PRNT("        p[13,1]= %g\n",p[13][1]);
                 PRNT("        p[25,1]= %g\n",p[25][1]);
                 PRNT("        x[1]= %g\n",x[1]);
                 PRNT("        p[24,1]= %g\n",p[24][1]);
-                PRNT("        p[17,0]= %g\n",p[17][0]);
                 PRNT("        x[3]= %g\n",x[3]);
-                PRNT("        p[3,0]= %g\n",p[3][0]);
                 PRNT("        x[0]= %g\n",x[0]);
                 PRNT("        x[4]= %g\n",x[4]);
-                PRNT("        p[3,1]= %g\n",p[3][1]);
-                PRNT("        p[16,0]= %g\n",p[16][0]);
                 PRNT("        p[14,0]= %g\n",p[14][0]);
             }
             return(0);
         }
-    t->cxx[3]=0.0;
-    t->cxx[4]=0.0;
-    t->cxx[5]=p[13][2]/sqrt(pow(p[24][2],2.0)+pow(x[2]-p[25][2],2.0))-p[13][2]*pow(x[2]-p[25][2],2.0)/pow(pow(p[24][2],2.0)+pow(x[2]-p[25][2],2.0),1.5);
-    if (isNANorINF(t->cxx[5]))
+    d->cxx[3]=0.0;
+    d->cxx[4]=0.0;
+    d->cxx[5]=p[13][2]/sqrt(pow(p[24][2],2.0)+pow(x[2]-p[25][2],2.0))-p[13][2]*pow(x[2]-p[25][2],2.0)/pow(pow(p[24][2],2.0)+pow(x[2]-p[25][2],2.0),1.5);
+    if (isNANorINF(d->cxx[5]))
         {
-            PRNT("    @k %d: t->cxx[5] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cxx[5]);
+            PRNT("    @k %d: d->cxx[5] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cxx[5]);
             {
                 PRNT("        p[13,2]= %g\n",p[13][2]);
                 PRNT("        p[25,2]= %g\n",p[25][2]);
@@ -3294,129 +3634,108 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->cxx[6]=p[17][0]*mcond(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4]<0.0,0.0,1,-pow(x[3],2.0)/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),1.5)+x[3]*(x[0]-p[3][0])*(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4])/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),1.5)/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),1.5)-pow(x[0]-p[3][0],2.0)/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),1.5)/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))+1/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0)));
-    if (isNANorINF(t->cxx[6]))
+    d->cxx[6]=0.0;
+    if (isNANorINF(d->cxx[6]))
         {
-            PRNT("    @k %d: t->cxx[6] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cxx[6]);
+            PRNT("    @k %d: d->cxx[6] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cxx[6]);
             {
-                PRNT("        p[17,0]= %g\n",p[17][0]);
                 PRNT("        x[3]= %g\n",x[3]);
-                PRNT("        p[3,0]= %g\n",p[3][0]);
                 PRNT("        x[0]= %g\n",x[0]);
                 PRNT("        x[4]= %g\n",x[4]);
-                PRNT("        p[3,1]= %g\n",p[3][1]);
                 PRNT("        x[1]= %g\n",x[1]);
             }
             return(0);
         }
-    t->cxx[7]=p[17][0]*mcond(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4]<0.0,0.0,1,-x[3]*x[4]/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),1.5)+x[3]*(x[1]-p[3][1])*(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4])/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),1.5)/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),1.5)-(x[0]-p[3][0])*(x[1]-p[3][1])/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),1.5)/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0)));
-    if (isNANorINF(t->cxx[7]))
+    d->cxx[7]=0.0;
+    if (isNANorINF(d->cxx[7]))
         {
-            PRNT("    @k %d: t->cxx[7] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cxx[7]);
+            PRNT("    @k %d: d->cxx[7] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cxx[7]);
             {
-                PRNT("        p[17,0]= %g\n",p[17][0]);
                 PRNT("        x[3]= %g\n",x[3]);
-                PRNT("        p[3,0]= %g\n",p[3][0]);
                 PRNT("        x[0]= %g\n",x[0]);
                 PRNT("        x[4]= %g\n",x[4]);
-                PRNT("        p[3,1]= %g\n",p[3][1]);
                 PRNT("        x[1]= %g\n",x[1]);
             }
             return(0);
         }
-    t->cxx[8]=0.0;
-    t->cxx[9]=-pow(x[3],2.0)*p[8][0]/pow(1.0+pow(x[3],2.0),1.5)+p[8][0]/sqrt(1.0+pow(x[3],2.0))+p[10][0]/sqrt(pow(p[24][0],2.0)+pow(x[3]-p[25][3],2.0))-p[10][0]*pow(x[3]-p[25][3],2.0)/pow(pow(p[24][0],2.0)+pow(x[3]-p[25][3],2.0),1.5)+p[17][0]*mcond(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4]<0.0,0.0,1,3.0*pow(x[3],2.0)*(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4])/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),2.5)-2.0*x[3]*(x[0]-p[3][0])/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),1.5)-(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4])/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),1.5));
-    if (isNANorINF(t->cxx[9]))
+    d->cxx[8]=0.0;
+    d->cxx[9]=-pow(x[3],2.0)*p[8][0]/pow(1.0+pow(x[3],2.0),1.5)+p[8][0]/sqrt(1.0+pow(x[3],2.0))+p[10][0]/sqrt(pow(p[24][0],2.0)+pow(x[3]-p[25][3],2.0))-p[10][0]*pow(x[3]-p[25][3],2.0)/pow(pow(p[24][0],2.0)+pow(x[3]-p[25][3],2.0),1.5);
+    if (isNANorINF(d->cxx[9]))
         {
-            PRNT("    @k %d: t->cxx[9] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cxx[9]);
+            PRNT("    @k %d: d->cxx[9] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cxx[9]);
             {
                 PRNT("        p[10,0]= %g\n",p[10][0]);
                 PRNT("        p[25,3]= %g\n",p[25][3]);
                 PRNT("        x[3]= %g\n",x[3]);
                 PRNT("        p[24,0]= %g\n",p[24][0]);
                 PRNT("        p[8,0]= %g\n",p[8][0]);
-                PRNT("        p[17,0]= %g\n",p[17][0]);
-                PRNT("        p[3,0]= %g\n",p[3][0]);
                 PRNT("        x[0]= %g\n",x[0]);
                 PRNT("        x[4]= %g\n",x[4]);
-                PRNT("        p[3,1]= %g\n",p[3][1]);
                 PRNT("        x[1]= %g\n",x[1]);
             }
             return(0);
         }
-    t->cxx[10]=p[17][0]*mcond(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4]<0.0,0.0,1,-x[3]*x[4]/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),1.5)+(x[0]-p[3][0])*x[4]*(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4])/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),1.5)/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),1.5)-(x[0]-p[3][0])*(x[1]-p[3][1])/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),1.5)/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0)));
-    if (isNANorINF(t->cxx[10]))
+    d->cxx[10]=0.0;
+    if (isNANorINF(d->cxx[10]))
         {
-            PRNT("    @k %d: t->cxx[10] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cxx[10]);
+            PRNT("    @k %d: d->cxx[10] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cxx[10]);
             {
-                PRNT("        p[17,0]= %g\n",p[17][0]);
                 PRNT("        x[3]= %g\n",x[3]);
-                PRNT("        p[3,0]= %g\n",p[3][0]);
                 PRNT("        x[0]= %g\n",x[0]);
                 PRNT("        x[4]= %g\n",x[4]);
-                PRNT("        p[3,1]= %g\n",p[3][1]);
                 PRNT("        x[1]= %g\n",x[1]);
             }
             return(0);
         }
-    t->cxx[11]=p[17][0]*mcond(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4]<0.0,0.0,1,(x[1]-p[3][1])*x[4]*(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4])/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),1.5)/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),1.5)-pow(x[4],2.0)/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),1.5)+1/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0))-pow(x[1]-p[3][1],2.0)/pow(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0),1.5)/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0)));
-    if (isNANorINF(t->cxx[11]))
+    d->cxx[11]=0.0;
+    if (isNANorINF(d->cxx[11]))
         {
-            PRNT("    @k %d: t->cxx[11] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cxx[11]);
+            PRNT("    @k %d: d->cxx[11] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cxx[11]);
             {
-                PRNT("        p[17,0]= %g\n",p[17][0]);
                 PRNT("        x[3]= %g\n",x[3]);
-                PRNT("        p[3,0]= %g\n",p[3][0]);
                 PRNT("        x[0]= %g\n",x[0]);
                 PRNT("        x[4]= %g\n",x[4]);
-                PRNT("        p[3,1]= %g\n",p[3][1]);
                 PRNT("        x[1]= %g\n",x[1]);
             }
             return(0);
         }
-    t->cxx[12]=0.0;
-    t->cxx[13]=p[17][0]*mcond(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4]<0.0,0.0,1,3.0*x[3]*x[4]*(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4])/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),2.5)-x[3]*(x[1]-p[3][1])/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),1.5)-(x[0]-p[3][0])*x[4]/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),1.5));
-    if (isNANorINF(t->cxx[13]))
+    d->cxx[12]=0.0;
+    d->cxx[13]=0.0;
+    if (isNANorINF(d->cxx[13]))
         {
-            PRNT("    @k %d: t->cxx[13] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cxx[13]);
+            PRNT("    @k %d: d->cxx[13] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cxx[13]);
             {
-                PRNT("        p[17,0]= %g\n",p[17][0]);
                 PRNT("        x[3]= %g\n",x[3]);
-                PRNT("        p[3,0]= %g\n",p[3][0]);
                 PRNT("        x[0]= %g\n",x[0]);
                 PRNT("        x[4]= %g\n",x[4]);
-                PRNT("        p[3,1]= %g\n",p[3][1]);
                 PRNT("        x[1]= %g\n",x[1]);
             }
             return(0);
         }
-    t->cxx[14]=p[10][1]/sqrt(pow(p[24][1],2.0)+pow(x[4]-p[25][4],2.0))-p[10][1]*pow(x[4]-p[25][4],2.0)/pow(pow(p[24][1],2.0)+pow(x[4]-p[25][4],2.0),1.5)+p[17][0]*mcond(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4]<0.0,0.0,1,3.0*pow(x[4],2.0)*(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4])/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),2.5)-2.0*(x[1]-p[3][1])*x[4]/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),1.5)-(x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4])/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))/pow(1.e-6+pow(x[3],2.0)+pow(x[4],2.0),1.5));
-    if (isNANorINF(t->cxx[14]))
+    d->cxx[14]=p[10][1]/sqrt(pow(p[24][1],2.0)+pow(x[4]-p[25][4],2.0))-p[10][1]*pow(x[4]-p[25][4],2.0)/pow(pow(p[24][1],2.0)+pow(x[4]-p[25][4],2.0),1.5);
+    if (isNANorINF(d->cxx[14]))
         {
-            PRNT("    @k %d: t->cxx[14] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cxx[14]);
+            PRNT("    @k %d: d->cxx[14] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cxx[14]);
             {
                 PRNT("        p[10,1]= %g\n",p[10][1]);
                 PRNT("        p[25,4]= %g\n",p[25][4]);
                 PRNT("        x[4]= %g\n",x[4]);
                 PRNT("        p[24,1]= %g\n",p[24][1]);
-                PRNT("        p[17,0]= %g\n",p[17][0]);
                 PRNT("        x[3]= %g\n",x[3]);
-                PRNT("        p[3,0]= %g\n",p[3][0]);
                 PRNT("        x[0]= %g\n",x[0]);
-                PRNT("        p[3,1]= %g\n",p[3][1]);
                 PRNT("        x[1]= %g\n",x[1]);
             }
             return(0);
         }
-    t->cxx[15]=0.0;
-    t->cxx[16]=0.0;
-    t->cxx[17]=0.0;
-    t->cxx[18]=0.0;
-    t->cxx[19]=0.0;
-    t->cxx[20]=p[10][2]/sqrt(pow(p[24][2],2.0)+pow(x[5]-p[25][5],2.0))-p[10][2]*pow(x[5]-p[25][5],2.0)/pow(pow(p[24][2],2.0)+pow(x[5]-p[25][5],2.0),1.5);
-    if (isNANorINF(t->cxx[20]))
+    d->cxx[15]=0.0;
+    d->cxx[16]=0.0;
+    d->cxx[17]=0.0;
+    d->cxx[18]=0.0;
+    d->cxx[19]=0.0;
+    d->cxx[20]=p[10][2]/sqrt(pow(p[24][2],2.0)+pow(x[5]-p[25][5],2.0))-p[10][2]*pow(x[5]-p[25][5],2.0)/pow(pow(p[24][2],2.0)+pow(x[5]-p[25][5],2.0),1.5);
+    if (isNANorINF(d->cxx[20]))
         {
-            PRNT("    @k %d: t->cxx[20] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cxx[20]);
+            PRNT("    @k %d: d->cxx[20] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cxx[20]);
             {
                 PRNT("        p[10,2]= %g\n",p[10][2]);
                 PRNT("        p[25,5]= %g\n",p[25][5]);
@@ -3425,71 +3744,71 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             }
             return(0);
         }
-    t->cxx[21]=0.0;
-    t->cxx[22]=0.0;
-    t->cxx[23]=0.0;
-    t->cxx[24]=0.0;
-    t->cxx[25]=0.0;
-    t->cxx[26]=0.0;
-    t->cxx[27]=0.0;
-    t->cxx[28]=0.0;
-    t->cxx[29]=0.0;
-    t->cxx[30]=0.0;
-    t->cxx[31]=0.0;
-    t->cxx[32]=0.0;
-    t->cxx[33]=0.0;
-    t->cxx[34]=0.0;
-    t->cxx[35]=0.0;
-    t->cxx[36]=0.0;
-    t->cxx[37]=0.0;
-    t->cxx[38]=0.0;
-    t->cxx[39]=0.0;
-    t->cxx[40]=0.0;
-    t->cxx[41]=0.0;
-    t->cxx[42]=0.0;
-    t->cxx[43]=0.0;
-    t->cxx[44]=2.0*p[9][0];
-    if (isNANorINF(t->cxx[44]))
-        {
-            PRNT("    @k %d: t->cxx[44] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cxx[44]);
+    d->cxx[21]=0.0;
+    d->cxx[22]=0.0;
+    d->cxx[23]=0.0;
+    d->cxx[24]=0.0;
+    d->cxx[25]=0.0;
+    d->cxx[26]=0.0;
+    d->cxx[27]=0.0;
+    d->cxx[28]=0.0;
+    d->cxx[29]=0.0;
+    d->cxx[30]=0.0;
+    d->cxx[31]=0.0;
+    d->cxx[32]=0.0;
+    d->cxx[33]=0.0;
+    d->cxx[34]=0.0;
+    d->cxx[35]=0.0;
+    d->cxx[36]=0.0;
+    d->cxx[37]=0.0;
+    d->cxx[38]=0.0;
+    d->cxx[39]=0.0;
+    d->cxx[40]=0.0;
+    d->cxx[41]=0.0;
+    d->cxx[42]=0.0;
+    d->cxx[43]=0.0;
+    d->cxx[44]=2.0*p[9][0];
+    if (isNANorINF(d->cxx[44]))
+        {
+            PRNT("    @k %d: d->cxx[44] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cxx[44]);
             {
                 PRNT("        p[9,0]= %g\n",p[9][0]);
             }
             return(0);
         }
-    t->cxx[45]=0.0;
-    t->cxx[46]=0.0;
-    t->cxx[47]=0.0;
-    t->cxx[48]=0.0;
-    t->cxx[49]=0.0;
-    t->cxx[50]=0.0;
-    t->cxx[51]=0.0;
-    t->cxx[52]=0.0;
-    t->cxx[53]=0.0;
-    t->cxx[54]=2.0*p[9][1];
-    if (isNANorINF(t->cxx[54]))
+    d->cxx[45]=0.0;
+    d->cxx[46]=0.0;
+    d->cxx[47]=0.0;
+    d->cxx[48]=0.0;
+    d->cxx[49]=0.0;
+    d->cxx[50]=0.0;
+    d->cxx[51]=0.0;
+    d->cxx[52]=0.0;
+    d->cxx[53]=0.0;
+    d->cxx[54]=2.0*p[9][1];
+    if (isNANorINF(d->cxx[54]))
         {
-            PRNT("    @k %d: t->cxx[54] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cxx[54]);
+            PRNT("    @k %d: d->cxx[54] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cxx[54]);
             {
                 PRNT("        p[9,1]= %g\n",p[9][1]);
             }
             return(0);
         }
 
-    t->cu[0]=2.0*u[0]*p[12][0];
-    if (isNANorINF(t->cu[0]))
+    d->cu[0]=2.0*u[0]*p[12][0];
+    if (isNANorINF(d->cu[0]))
         {
-            PRNT("    @k %d: t->cu[0] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cu[0]);
+            PRNT("    @k %d: d->cu[0] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cu[0]);
             {
                 PRNT("        p[12,0]= %g\n",p[12][0]);
                 PRNT("        u[0]= %g\n",u[0]);
             }
             return(0);
         }
-    t->cu[1]=2.0*u[1]*p[12][1];
-    if (isNANorINF(t->cu[1]))
+    d->cu[1]=2.0*u[1]*p[12][1];
+    if (isNANorINF(d->cu[1]))
         {
-            PRNT("    @k %d: t->cu[1] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cu[1]);
+            PRNT("    @k %d: d->cu[1] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cu[1]);
             {
                 PRNT("        p[12,1]= %g\n",p[12][1]);
                 PRNT("        u[1]= %g\n",u[1]);
@@ -3497,46 +3816,46 @@ static int bp_derivsL(trajEl_t *t, int k, double **p) {
             return(0);
         }
 
-    t->cuu[0]=2.0*p[12][0];
-    if (isNANorINF(t->cuu[0]))
+    d->cuu[0]=2.0*p[12][0];
+    if (isNANorINF(d->cuu[0]))
         {
-            PRNT("    @k %d: t->cuu[0] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cuu[0]);
+            PRNT("    @k %d: d->cuu[0] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cuu[0]);
             {
                 PRNT("        p[12,0]= %g\n",p[12][0]);
             }
             return(0);
         }
-    t->cuu[1]=0.0;
-    t->cuu[2]=2.0*p[12][1];
-    if (isNANorINF(t->cuu[2]))
+    d->cuu[1]=0.0;
+    d->cuu[2]=2.0*p[12][1];
+    if (isNANorINF(d->cuu[2]))
         {
-            PRNT("    @k %d: t->cuu[2] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cuu[2]);
+            PRNT("    @k %d: d->cuu[2] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cuu[2]);
             {
                 PRNT("        p[12,1]= %g\n",p[12][1]);
             }
             return(0);
         }
 
-    t->cxu[0]=0.0;
-    t->cxu[1]=0.0;
-    t->cxu[2]=0.0;
-    t->cxu[3]=0.0;
-    t->cxu[4]=0.0;
-    t->cxu[5]=0.0;
-    t->cxu[6]=0.0;
-    t->cxu[7]=0.0;
-    t->cxu[8]=0.0;
-    t->cxu[9]=0.0;
-    t->cxu[10]=0.0;
-    t->cxu[11]=0.0;
-    t->cxu[12]=0.0;
-    t->cxu[13]=0.0;
-    t->cxu[14]=0.0;
-    t->cxu[15]=0.0;
-    t->cxu[16]=0.0;
-    t->cxu[17]=0.0;
-    t->cxu[18]=0.0;
-    t->cxu[19]=0.0;
+    d->cxu[0]=0.0;
+    d->cxu[1]=0.0;
+    d->cxu[2]=0.0;
+    d->cxu[3]=0.0;
+    d->cxu[4]=0.0;
+    d->cxu[5]=0.0;
+    d->cxu[6]=0.0;
+    d->cxu[7]=0.0;
+    d->cxu[8]=0.0;
+    d->cxu[9]=0.0;
+    d->cxu[10]=0.0;
+    d->cxu[11]=0.0;
+    d->cxu[12]=0.0;
+    d->cxu[13]=0.0;
+    d->cxu[14]=0.0;
+    d->cxu[15]=0.0;
+    d->cxu[16]=0.0;
+    d->cxu[17]=0.0;
+    d->cxu[18]=0.0;
+    d->cxu[19]=0.0;
 
     return 1;
 }
@@ -3754,71 +4073,71 @@ static int bp_derivsF(trajFin_t *t, int k, double **p) {
     return 1;
 }
 
-static int init_running(trajEl_t *t, tOptSet *o) {
+static int init_running(derivEl_t *d, tOptSet *o) {
     int k;
     double **p= o->p;
     
-    for(k= 0; k<o->n_hor; k++, t++) {
+    for(k= 0; k<o->n_hor; k++, d++) {
 
 
 // derivatives of L
-    t->cx[6]=0.0;
-    t->cx[7]=0.0;
+    d->cx[6]=0.0;
+    d->cx[7]=0.0;
 
-    t->cxx[3]=0.0;
-    t->cxx[4]=0.0;
-    t->cxx[8]=0.0;
-    t->cxx[12]=0.0;
-    t->cxx[15]=0.0;
-    t->cxx[16]=0.0;
-    t->cxx[17]=0.0;
-    t->cxx[18]=0.0;
-    t->cxx[19]=0.0;
-    t->cxx[21]=0.0;
-    t->cxx[22]=0.0;
-    t->cxx[23]=0.0;
-    t->cxx[24]=0.0;
-    t->cxx[25]=0.0;
-    t->cxx[26]=0.0;
-    t->cxx[27]=0.0;
-    t->cxx[28]=0.0;
-    t->cxx[29]=0.0;
-    t->cxx[30]=0.0;
-    t->cxx[31]=0.0;
-    t->cxx[32]=0.0;
-    t->cxx[33]=0.0;
-    t->cxx[34]=0.0;
-    t->cxx[35]=0.0;
-    t->cxx[36]=0.0;
-    t->cxx[37]=0.0;
-    t->cxx[38]=0.0;
-    t->cxx[39]=0.0;
-    t->cxx[40]=0.0;
-    t->cxx[41]=0.0;
-    t->cxx[42]=0.0;
-    t->cxx[43]=0.0;
-    t->cxx[44]=2.0*p[9][0];
-    if (isNANorINF(t->cxx[44]))
-        {
-            PRNT("    @k %d: t->cxx[44] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cxx[44]);
+    d->cxx[3]=0.0;
+    d->cxx[4]=0.0;
+    d->cxx[8]=0.0;
+    d->cxx[12]=0.0;
+    d->cxx[15]=0.0;
+    d->cxx[16]=0.0;
+    d->cxx[17]=0.0;
+    d->cxx[18]=0.0;
+    d->cxx[19]=0.0;
+    d->cxx[21]=0.0;
+    d->cxx[22]=0.0;
+    d->cxx[23]=0.0;
+    d->cxx[24]=0.0;
+    d->cxx[25]=0.0;
+    d->cxx[26]=0.0;
+    d->cxx[27]=0.0;
+    d->cxx[28]=0.0;
+    d->cxx[29]=0.0;
+    d->cxx[30]=0.0;
+    d->cxx[31]=0.0;
+    d->cxx[32]=0.0;
+    d->cxx[33]=0.0;
+    d->cxx[34]=0.0;
+    d->cxx[35]=0.0;
+    d->cxx[36]=0.0;
+    d->cxx[37]=0.0;
+    d->cxx[38]=0.0;
+    d->cxx[39]=0.0;
+    d->cxx[40]=0.0;
+    d->cxx[41]=0.0;
+    d->cxx[42]=0.0;
+    d->cxx[43]=0.0;
+    d->cxx[44]=2.0*p[9][0];
+    if (isNANorINF(d->cxx[44]))
+        {
+            PRNT("    @k %d: d->cxx[44] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cxx[44]);
             {
                 PRNT("        p[9,0]= %g\n",p[9][0]);
             }
             return(0);
         }
-    t->cxx[45]=0.0;
-    t->cxx[46]=0.0;
-    t->cxx[47]=0.0;
-    t->cxx[48]=0.0;
-    t->cxx[49]=0.0;
-    t->cxx[50]=0.0;
-    t->cxx[51]=0.0;
-    t->cxx[52]=0.0;
-    t->cxx[53]=0.0;
-    t->cxx[54]=2.0*p[9][1];
-    if (isNANorINF(t->cxx[54]))
+    d->cxx[45]=0.0;
+    d->cxx[46]=0.0;
+    d->cxx[47]=0.0;
+    d->cxx[48]=0.0;
+    d->cxx[49]=0.0;
+    d->cxx[50]=0.0;
+    d->cxx[51]=0.0;
+    d->cxx[52]=0.0;
+    d->cxx[53]=0.0;
+    d->cxx[54]=2.0*p[9][1];
+    if (isNANorINF(d->cxx[54]))
         {
-            PRNT("    @k %d: t->cxx[54] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cxx[54]);
+            PRNT("    @k %d: d->cxx[54] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cxx[54]);
             {
                 PRNT("        p[9,1]= %g\n",p[9][1]);
             }
@@ -3826,1060 +4145,1060 @@ static int init_running(trajEl_t *t, tOptSet *o) {
         }
 
 
-    t->cuu[0]=2.0*p[12][0];
-    if (isNANorINF(t->cuu[0]))
+    d->cuu[0]=2.0*p[12][0];
+    if (isNANorINF(d->cuu[0]))
         {
-            PRNT("    @k %d: t->cuu[0] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cuu[0]);
+            PRNT("    @k %d: d->cuu[0] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cuu[0]);
             {
                 PRNT("        p[12,0]= %g\n",p[12][0]);
             }
             return(0);
         }
-    t->cuu[1]=0.0;
-    t->cuu[2]=2.0*p[12][1];
-    if (isNANorINF(t->cuu[2]))
+    d->cuu[1]=0.0;
+    d->cuu[2]=2.0*p[12][1];
+    if (isNANorINF(d->cuu[2]))
         {
-            PRNT("    @k %d: t->cuu[2] in line %d is nan or inf: %g\n", k, __LINE__-3,t->cuu[2]);
+            PRNT("    @k %d: d->cuu[2] in line %d is nan or inf: %g\n", k, __LINE__-3,d->cuu[2]);
             {
                 PRNT("        p[12,1]= %g\n",p[12][1]);
             }
             return(0);
         }
 
-    t->cxu[0]=0.0;
-    t->cxu[1]=0.0;
-    t->cxu[2]=0.0;
-    t->cxu[3]=0.0;
-    t->cxu[4]=0.0;
-    t->cxu[5]=0.0;
-    t->cxu[6]=0.0;
-    t->cxu[7]=0.0;
-    t->cxu[8]=0.0;
-    t->cxu[9]=0.0;
-    t->cxu[10]=0.0;
-    t->cxu[11]=0.0;
-    t->cxu[12]=0.0;
-    t->cxu[13]=0.0;
-    t->cxu[14]=0.0;
-    t->cxu[15]=0.0;
-    t->cxu[16]=0.0;
-    t->cxu[17]=0.0;
-    t->cxu[18]=0.0;
-    t->cxu[19]=0.0;
+    d->cxu[0]=0.0;
+    d->cxu[1]=0.0;
+    d->cxu[2]=0.0;
+    d->cxu[3]=0.0;
+    d->cxu[4]=0.0;
+    d->cxu[5]=0.0;
+    d->cxu[6]=0.0;
+    d->cxu[7]=0.0;
+    d->cxu[8]=0.0;
+    d->cxu[9]=0.0;
+    d->cxu[10]=0.0;
+    d->cxu[11]=0.0;
+    d->cxu[12]=0.0;
+    d->cxu[13]=0.0;
+    d->cxu[14]=0.0;
+    d->cxu[15]=0.0;
+    d->cxu[16]=0.0;
+    d->cxu[17]=0.0;
+    d->cxu[18]=0.0;
+    d->cxu[19]=0.0;
 
 // derivatives of f
 // df[i]/d x[0]
-    t->fx[0]=1.0;
-    t->fx[1]=0.0;
-    t->fx[2]=0.0;
-    t->fx[3]=0.0;
-    t->fx[4]=0.0;
-    t->fx[5]=0.0;
-    t->fx[6]=0.0;
-    t->fx[7]=0.0;
-    t->fx[8]=0.0;
-    t->fx[9]=0.0;
+    d->fx[0]=1.0;
+    d->fx[1]=0.0;
+    d->fx[2]=0.0;
+    d->fx[3]=0.0;
+    d->fx[4]=0.0;
+    d->fx[5]=0.0;
+    d->fx[6]=0.0;
+    d->fx[7]=0.0;
+    d->fx[8]=0.0;
+    d->fx[9]=0.0;
 // df[i]/d x[1]
-    t->fx[10]=0.0;
-    t->fx[11]=1.0;
-    t->fx[12]=0.0;
-    t->fx[13]=0.0;
-    t->fx[14]=0.0;
-    t->fx[15]=0.0;
-    t->fx[16]=0.0;
-    t->fx[17]=0.0;
-    t->fx[18]=0.0;
-    t->fx[19]=0.0;
+    d->fx[10]=0.0;
+    d->fx[11]=1.0;
+    d->fx[12]=0.0;
+    d->fx[13]=0.0;
+    d->fx[14]=0.0;
+    d->fx[15]=0.0;
+    d->fx[16]=0.0;
+    d->fx[17]=0.0;
+    d->fx[18]=0.0;
+    d->fx[19]=0.0;
 // df[i]/d x[2]
-    t->fx[22]=1.0;
-    t->fx[23]=0.0;
-    t->fx[24]=0.0;
-    t->fx[25]=0.0;
-    t->fx[26]=0.0;
-    t->fx[27]=0.0;
-    t->fx[28]=0.0;
-    t->fx[29]=0.0;
+    d->fx[22]=1.0;
+    d->fx[23]=0.0;
+    d->fx[24]=0.0;
+    d->fx[25]=0.0;
+    d->fx[26]=0.0;
+    d->fx[27]=0.0;
+    d->fx[28]=0.0;
+    d->fx[29]=0.0;
 // df[i]/d x[3]
-    t->fx[32]=0.0;
-    t->fx[36]=0.0;
-    t->fx[37]=0.0;
-    t->fx[38]=0.0;
-    t->fx[39]=0.0;
+    d->fx[32]=0.0;
+    d->fx[36]=0.0;
+    d->fx[37]=0.0;
+    d->fx[38]=0.0;
+    d->fx[39]=0.0;
 // df[i]/d x[4]
-    t->fx[42]=0.0;
-    t->fx[46]=0.0;
-    t->fx[47]=0.0;
-    t->fx[48]=0.0;
-    t->fx[49]=0.0;
+    d->fx[42]=0.0;
+    d->fx[46]=0.0;
+    d->fx[47]=0.0;
+    d->fx[48]=0.0;
+    d->fx[49]=0.0;
 // df[i]/d x[5]
-    t->fx[50]=0.0;
-    t->fx[51]=0.0;
-    t->fx[52]=p[15][0];
-    t->fx[56]=0.0;
-    t->fx[57]=0.0;
-    t->fx[58]=0.0;
-    t->fx[59]=0.0;
+    d->fx[50]=0.0;
+    d->fx[51]=0.0;
+    d->fx[52]=p[15][0];
+    d->fx[56]=0.0;
+    d->fx[57]=0.0;
+    d->fx[58]=0.0;
+    d->fx[59]=0.0;
 // df[i]/d x[6]
-    t->fx[60]=0.0;
-    t->fx[61]=0.0;
-    t->fx[62]=0.0;
-    t->fx[63]=0.0;
-    t->fx[64]=0.0;
-    t->fx[65]=0.0;
-    t->fx[66]=0.0;
-    t->fx[67]=0.0;
-    t->fx[68]=-1.0;
-    t->fx[69]=0.0;
+    d->fx[60]=0.0;
+    d->fx[61]=0.0;
+    d->fx[62]=0.0;
+    d->fx[63]=0.0;
+    d->fx[64]=0.0;
+    d->fx[65]=0.0;
+    d->fx[66]=0.0;
+    d->fx[67]=0.0;
+    d->fx[68]=-1.0;
+    d->fx[69]=0.0;
 // df[i]/d x[7]
-    t->fx[70]=0.0;
-    t->fx[71]=0.0;
-    t->fx[72]=0.0;
-    t->fx[73]=0.0;
-    t->fx[74]=0.0;
-    t->fx[75]=0.0;
-    t->fx[76]=0.0;
-    t->fx[77]=0.0;
-    t->fx[78]=0.0;
-    t->fx[79]=-1.0;
+    d->fx[70]=0.0;
+    d->fx[71]=0.0;
+    d->fx[72]=0.0;
+    d->fx[73]=0.0;
+    d->fx[74]=0.0;
+    d->fx[75]=0.0;
+    d->fx[76]=0.0;
+    d->fx[77]=0.0;
+    d->fx[78]=0.0;
+    d->fx[79]=-1.0;
 // df[i]/d x[8]
-    t->fx[80]=0.0;
-    t->fx[81]=0.0;
-    t->fx[82]=0.0;
-    t->fx[83]=0.0;
-    t->fx[84]=0.0;
-    t->fx[85]=0.0;
-    t->fx[86]=0.0;
-    t->fx[87]=0.0;
-    t->fx[88]=0.0;
-    t->fx[89]=0.0;
+    d->fx[80]=0.0;
+    d->fx[81]=0.0;
+    d->fx[82]=0.0;
+    d->fx[83]=0.0;
+    d->fx[84]=0.0;
+    d->fx[85]=0.0;
+    d->fx[86]=0.0;
+    d->fx[87]=0.0;
+    d->fx[88]=0.0;
+    d->fx[89]=0.0;
 // df[i]/d x[9]
-    t->fx[90]=0.0;
-    t->fx[91]=0.0;
-    t->fx[92]=0.0;
-    t->fx[93]=0.0;
-    t->fx[94]=0.0;
-    t->fx[95]=0.0;
-    t->fx[96]=0.0;
-    t->fx[97]=0.0;
-    t->fx[98]=0.0;
-    t->fx[99]=0.0;
+    d->fx[90]=0.0;
+    d->fx[91]=0.0;
+    d->fx[92]=0.0;
+    d->fx[93]=0.0;
+    d->fx[94]=0.0;
+    d->fx[95]=0.0;
+    d->fx[96]=0.0;
+    d->fx[97]=0.0;
+    d->fx[98]=0.0;
+    d->fx[99]=0.0;
 
 // df[i]/d u[0]
-    t->fu[0]=0.0;
-    t->fu[1]=0.0;
-    t->fu[2]=0.0;
-    t->fu[6]=1.0;
-    t->fu[7]=0.0;
-    t->fu[8]=1.0;
-    t->fu[9]=0.0;
+    d->fu[0]=0.0;
+    d->fu[1]=0.0;
+    d->fu[2]=0.0;
+    d->fu[6]=1.0;
+    d->fu[7]=0.0;
+    d->fu[8]=1.0;
+    d->fu[9]=0.0;
 // df[i]/d u[1]
-    t->fu[10]=0.0;
-    t->fu[11]=0.0;
-    t->fu[12]=0.0;
-    t->fu[16]=0.0;
-    t->fu[17]=1.0;
-    t->fu[18]=0.0;
-    t->fu[19]=1.0;
+    d->fu[10]=0.0;
+    d->fu[11]=0.0;
+    d->fu[12]=0.0;
+    d->fu[16]=0.0;
+    d->fu[17]=1.0;
+    d->fu[18]=0.0;
+    d->fu[19]=1.0;
 
 #if FULL_DDP
 // d^2f[0]/dx[i] dx[j]
 // j= 0
-    t->fxx[0]=0.0;
+    d->fxx[0]=0.0;
 // j= 1
-    t->fxx[1]=0.0;
-    t->fxx[2]=0.0;
+    d->fxx[1]=0.0;
+    d->fxx[2]=0.0;
 // j= 2
-    t->fxx[3]=0.0;
-    t->fxx[4]=0.0;
+    d->fxx[3]=0.0;
+    d->fxx[4]=0.0;
 // j= 3
-    t->fxx[6]=0.0;
-    t->fxx[7]=0.0;
+    d->fxx[6]=0.0;
+    d->fxx[7]=0.0;
 // j= 4
-    t->fxx[10]=0.0;
-    t->fxx[11]=0.0;
+    d->fxx[10]=0.0;
+    d->fxx[11]=0.0;
 // j= 5
-    t->fxx[15]=0.0;
-    t->fxx[16]=0.0;
-    t->fxx[17]=0.0;
-    t->fxx[18]=0.0;
-    t->fxx[19]=0.0;
-    t->fxx[20]=0.0;
+    d->fxx[15]=0.0;
+    d->fxx[16]=0.0;
+    d->fxx[17]=0.0;
+    d->fxx[18]=0.0;
+    d->fxx[19]=0.0;
+    d->fxx[20]=0.0;
 // j= 6
-    t->fxx[21]=0.0;
-    t->fxx[22]=0.0;
-    t->fxx[23]=0.0;
-    t->fxx[24]=0.0;
-    t->fxx[25]=0.0;
-    t->fxx[26]=0.0;
-    t->fxx[27]=0.0;
+    d->fxx[21]=0.0;
+    d->fxx[22]=0.0;
+    d->fxx[23]=0.0;
+    d->fxx[24]=0.0;
+    d->fxx[25]=0.0;
+    d->fxx[26]=0.0;
+    d->fxx[27]=0.0;
 // j= 7
-    t->fxx[28]=0.0;
-    t->fxx[29]=0.0;
-    t->fxx[30]=0.0;
-    t->fxx[31]=0.0;
-    t->fxx[32]=0.0;
-    t->fxx[33]=0.0;
-    t->fxx[34]=0.0;
-    t->fxx[35]=0.0;
+    d->fxx[28]=0.0;
+    d->fxx[29]=0.0;
+    d->fxx[30]=0.0;
+    d->fxx[31]=0.0;
+    d->fxx[32]=0.0;
+    d->fxx[33]=0.0;
+    d->fxx[34]=0.0;
+    d->fxx[35]=0.0;
 // j= 8
-    t->fxx[36]=0.0;
-    t->fxx[37]=0.0;
-    t->fxx[38]=0.0;
-    t->fxx[39]=0.0;
-    t->fxx[40]=0.0;
-    t->fxx[41]=0.0;
-    t->fxx[42]=0.0;
-    t->fxx[43]=0.0;
-    t->fxx[44]=0.0;
+    d->fxx[36]=0.0;
+    d->fxx[37]=0.0;
+    d->fxx[38]=0.0;
+    d->fxx[39]=0.0;
+    d->fxx[40]=0.0;
+    d->fxx[41]=0.0;
+    d->fxx[42]=0.0;
+    d->fxx[43]=0.0;
+    d->fxx[44]=0.0;
 // j= 9
-    t->fxx[45]=0.0;
-    t->fxx[46]=0.0;
-    t->fxx[47]=0.0;
-    t->fxx[48]=0.0;
-    t->fxx[49]=0.0;
-    t->fxx[50]=0.0;
-    t->fxx[51]=0.0;
-    t->fxx[52]=0.0;
-    t->fxx[53]=0.0;
-    t->fxx[54]=0.0;
+    d->fxx[45]=0.0;
+    d->fxx[46]=0.0;
+    d->fxx[47]=0.0;
+    d->fxx[48]=0.0;
+    d->fxx[49]=0.0;
+    d->fxx[50]=0.0;
+    d->fxx[51]=0.0;
+    d->fxx[52]=0.0;
+    d->fxx[53]=0.0;
+    d->fxx[54]=0.0;
 // d^2f[1]/dx[i] dx[j]
 // j= 0
-    t->fxx[55]=0.0;
+    d->fxx[55]=0.0;
 // j= 1
-    t->fxx[56]=0.0;
-    t->fxx[57]=0.0;
+    d->fxx[56]=0.0;
+    d->fxx[57]=0.0;
 // j= 2
-    t->fxx[58]=0.0;
-    t->fxx[59]=0.0;
+    d->fxx[58]=0.0;
+    d->fxx[59]=0.0;
 // j= 3
-    t->fxx[61]=0.0;
-    t->fxx[62]=0.0;
+    d->fxx[61]=0.0;
+    d->fxx[62]=0.0;
 // j= 4
-    t->fxx[65]=0.0;
-    t->fxx[66]=0.0;
+    d->fxx[65]=0.0;
+    d->fxx[66]=0.0;
 // j= 5
-    t->fxx[70]=0.0;
-    t->fxx[71]=0.0;
-    t->fxx[72]=0.0;
-    t->fxx[73]=0.0;
-    t->fxx[74]=0.0;
-    t->fxx[75]=0.0;
+    d->fxx[70]=0.0;
+    d->fxx[71]=0.0;
+    d->fxx[72]=0.0;
+    d->fxx[73]=0.0;
+    d->fxx[74]=0.0;
+    d->fxx[75]=0.0;
 // j= 6
-    t->fxx[76]=0.0;
-    t->fxx[77]=0.0;
-    t->fxx[78]=0.0;
-    t->fxx[79]=0.0;
-    t->fxx[80]=0.0;
-    t->fxx[81]=0.0;
-    t->fxx[82]=0.0;
+    d->fxx[76]=0.0;
+    d->fxx[77]=0.0;
+    d->fxx[78]=0.0;
+    d->fxx[79]=0.0;
+    d->fxx[80]=0.0;
+    d->fxx[81]=0.0;
+    d->fxx[82]=0.0;
 // j= 7
-    t->fxx[83]=0.0;
-    t->fxx[84]=0.0;
-    t->fxx[85]=0.0;
-    t->fxx[86]=0.0;
-    t->fxx[87]=0.0;
-    t->fxx[88]=0.0;
-    t->fxx[89]=0.0;
-    t->fxx[90]=0.0;
+    d->fxx[83]=0.0;
+    d->fxx[84]=0.0;
+    d->fxx[85]=0.0;
+    d->fxx[86]=0.0;
+    d->fxx[87]=0.0;
+    d->fxx[88]=0.0;
+    d->fxx[89]=0.0;
+    d->fxx[90]=0.0;
 // j= 8
-    t->fxx[91]=0.0;
-    t->fxx[92]=0.0;
-    t->fxx[93]=0.0;
-    t->fxx[94]=0.0;
-    t->fxx[95]=0.0;
-    t->fxx[96]=0.0;
-    t->fxx[97]=0.0;
-    t->fxx[98]=0.0;
-    t->fxx[99]=0.0;
+    d->fxx[91]=0.0;
+    d->fxx[92]=0.0;
+    d->fxx[93]=0.0;
+    d->fxx[94]=0.0;
+    d->fxx[95]=0.0;
+    d->fxx[96]=0.0;
+    d->fxx[97]=0.0;
+    d->fxx[98]=0.0;
+    d->fxx[99]=0.0;
 // j= 9
-    t->fxx[100]=0.0;
-    t->fxx[101]=0.0;
-    t->fxx[102]=0.0;
-    t->fxx[103]=0.0;
-    t->fxx[104]=0.0;
-    t->fxx[105]=0.0;
-    t->fxx[106]=0.0;
-    t->fxx[107]=0.0;
-    t->fxx[108]=0.0;
-    t->fxx[109]=0.0;
+    d->fxx[100]=0.0;
+    d->fxx[101]=0.0;
+    d->fxx[102]=0.0;
+    d->fxx[103]=0.0;
+    d->fxx[104]=0.0;
+    d->fxx[105]=0.0;
+    d->fxx[106]=0.0;
+    d->fxx[107]=0.0;
+    d->fxx[108]=0.0;
+    d->fxx[109]=0.0;
 // d^2f[2]/dx[i] dx[j]
 // j= 0
-    t->fxx[110]=0.0;
+    d->fxx[110]=0.0;
 // j= 1
-    t->fxx[111]=0.0;
-    t->fxx[112]=0.0;
+    d->fxx[111]=0.0;
+    d->fxx[112]=0.0;
 // j= 2
-    t->fxx[113]=0.0;
-    t->fxx[114]=0.0;
-    t->fxx[115]=0.0;
+    d->fxx[113]=0.0;
+    d->fxx[114]=0.0;
+    d->fxx[115]=0.0;
 // j= 3
-    t->fxx[116]=0.0;
-    t->fxx[117]=0.0;
-    t->fxx[118]=0.0;
-    t->fxx[119]=0.0;
+    d->fxx[116]=0.0;
+    d->fxx[117]=0.0;
+    d->fxx[118]=0.0;
+    d->fxx[119]=0.0;
 // j= 4
-    t->fxx[120]=0.0;
-    t->fxx[121]=0.0;
-    t->fxx[122]=0.0;
-    t->fxx[123]=0.0;
-    t->fxx[124]=0.0;
+    d->fxx[120]=0.0;
+    d->fxx[121]=0.0;
+    d->fxx[122]=0.0;
+    d->fxx[123]=0.0;
+    d->fxx[124]=0.0;
 // j= 5
-    t->fxx[125]=0.0;
-    t->fxx[126]=0.0;
-    t->fxx[127]=0.0;
-    t->fxx[128]=0.0;
-    t->fxx[129]=0.0;
-    t->fxx[130]=0.0;
+    d->fxx[125]=0.0;
+    d->fxx[126]=0.0;
+    d->fxx[127]=0.0;
+    d->fxx[128]=0.0;
+    d->fxx[129]=0.0;
+    d->fxx[130]=0.0;
 // j= 6
-    t->fxx[131]=0.0;
-    t->fxx[132]=0.0;
-    t->fxx[133]=0.0;
-    t->fxx[134]=0.0;
-    t->fxx[135]=0.0;
-    t->fxx[136]=0.0;
-    t->fxx[137]=0.0;
+    d->fxx[131]=0.0;
+    d->fxx[132]=0.0;
+    d->fxx[133]=0.0;
+    d->fxx[134]=0.0;
+    d->fxx[135]=0.0;
+    d->fxx[136]=0.0;
+    d->fxx[137]=0.0;
 // j= 7
-    t->fxx[138]=0.0;
-    t->fxx[139]=0.0;
-    t->fxx[140]=0.0;
-    t->fxx[141]=0.0;
-    t->fxx[142]=0.0;
-    t->fxx[143]=0.0;
-    t->fxx[144]=0.0;
-    t->fxx[145]=0.0;
+    d->fxx[138]=0.0;
+    d->fxx[139]=0.0;
+    d->fxx[140]=0.0;
+    d->fxx[141]=0.0;
+    d->fxx[142]=0.0;
+    d->fxx[143]=0.0;
+    d->fxx[144]=0.0;
+    d->fxx[145]=0.0;
 // j= 8
-    t->fxx[146]=0.0;
-    t->fxx[147]=0.0;
-    t->fxx[148]=0.0;
-    t->fxx[149]=0.0;
-    t->fxx[150]=0.0;
-    t->fxx[151]=0.0;
-    t->fxx[152]=0.0;
-    t->fxx[153]=0.0;
-    t->fxx[154]=0.0;
+    d->fxx[146]=0.0;
+    d->fxx[147]=0.0;
+    d->fxx[148]=0.0;
+    d->fxx[149]=0.0;
+    d->fxx[150]=0.0;
+    d->fxx[151]=0.0;
+    d->fxx[152]=0.0;
+    d->fxx[153]=0.0;
+    d->fxx[154]=0.0;
 // j= 9
-    t->fxx[155]=0.0;
-    t->fxx[156]=0.0;
-    t->fxx[157]=0.0;
-    t->fxx[158]=0.0;
-    t->fxx[159]=0.0;
-    t->fxx[160]=0.0;
-    t->fxx[161]=0.0;
-    t->fxx[162]=0.0;
-    t->fxx[163]=0.0;
-    t->fxx[164]=0.0;
+    d->fxx[155]=0.0;
+    d->fxx[156]=0.0;
+    d->fxx[157]=0.0;
+    d->fxx[158]=0.0;
+    d->fxx[159]=0.0;
+    d->fxx[160]=0.0;
+    d->fxx[161]=0.0;
+    d->fxx[162]=0.0;
+    d->fxx[163]=0.0;
+    d->fxx[164]=0.0;
 // d^2f[3]/dx[i] dx[j]
 // j= 0
-    t->fxx[165]=0.0;
+    d->fxx[165]=0.0;
 // j= 1
-    t->fxx[166]=0.0;
-    t->fxx[167]=0.0;
+    d->fxx[166]=0.0;
+    d->fxx[167]=0.0;
 // j= 2
-    t->fxx[168]=0.0;
-    t->fxx[169]=0.0;
-    t->fxx[170]=0.0;
+    d->fxx[168]=0.0;
+    d->fxx[169]=0.0;
+    d->fxx[170]=0.0;
 // j= 3
-    t->fxx[171]=0.0;
-    t->fxx[172]=0.0;
-    t->fxx[173]=0.0;
+    d->fxx[171]=0.0;
+    d->fxx[172]=0.0;
+    d->fxx[173]=0.0;
 // j= 4
-    t->fxx[175]=0.0;
-    t->fxx[176]=0.0;
-    t->fxx[177]=0.0;
+    d->fxx[175]=0.0;
+    d->fxx[176]=0.0;
+    d->fxx[177]=0.0;
 // j= 5
-    t->fxx[180]=0.0;
-    t->fxx[181]=0.0;
-    t->fxx[182]=0.0;
+    d->fxx[180]=0.0;
+    d->fxx[181]=0.0;
+    d->fxx[182]=0.0;
 // j= 6
-    t->fxx[186]=0.0;
-    t->fxx[187]=0.0;
-    t->fxx[188]=0.0;
-    t->fxx[189]=0.0;
-    t->fxx[190]=0.0;
-    t->fxx[191]=0.0;
-    t->fxx[192]=0.0;
+    d->fxx[186]=0.0;
+    d->fxx[187]=0.0;
+    d->fxx[188]=0.0;
+    d->fxx[189]=0.0;
+    d->fxx[190]=0.0;
+    d->fxx[191]=0.0;
+    d->fxx[192]=0.0;
 // j= 7
-    t->fxx[193]=0.0;
-    t->fxx[194]=0.0;
-    t->fxx[195]=0.0;
-    t->fxx[196]=0.0;
-    t->fxx[197]=0.0;
-    t->fxx[198]=0.0;
-    t->fxx[199]=0.0;
-    t->fxx[200]=0.0;
+    d->fxx[193]=0.0;
+    d->fxx[194]=0.0;
+    d->fxx[195]=0.0;
+    d->fxx[196]=0.0;
+    d->fxx[197]=0.0;
+    d->fxx[198]=0.0;
+    d->fxx[199]=0.0;
+    d->fxx[200]=0.0;
 // j= 8
-    t->fxx[201]=0.0;
-    t->fxx[202]=0.0;
-    t->fxx[203]=0.0;
-    t->fxx[204]=0.0;
-    t->fxx[205]=0.0;
-    t->fxx[206]=0.0;
-    t->fxx[207]=0.0;
-    t->fxx[208]=0.0;
-    t->fxx[209]=0.0;
+    d->fxx[201]=0.0;
+    d->fxx[202]=0.0;
+    d->fxx[203]=0.0;
+    d->fxx[204]=0.0;
+    d->fxx[205]=0.0;
+    d->fxx[206]=0.0;
+    d->fxx[207]=0.0;
+    d->fxx[208]=0.0;
+    d->fxx[209]=0.0;
 // j= 9
-    t->fxx[210]=0.0;
-    t->fxx[211]=0.0;
-    t->fxx[212]=0.0;
-    t->fxx[213]=0.0;
-    t->fxx[214]=0.0;
-    t->fxx[215]=0.0;
-    t->fxx[216]=0.0;
-    t->fxx[217]=0.0;
-    t->fxx[218]=0.0;
-    t->fxx[219]=0.0;
+    d->fxx[210]=0.0;
+    d->fxx[211]=0.0;
+    d->fxx[212]=0.0;
+    d->fxx[213]=0.0;
+    d->fxx[214]=0.0;
+    d->fxx[215]=0.0;
+    d->fxx[216]=0.0;
+    d->fxx[217]=0.0;
+    d->fxx[218]=0.0;
+    d->fxx[219]=0.0;
 // d^2f[4]/dx[i] dx[j]
 // j= 0
-    t->fxx[220]=0.0;
+    d->fxx[220]=0.0;
 // j= 1
-    t->fxx[221]=0.0;
-    t->fxx[222]=0.0;
+    d->fxx[221]=0.0;
+    d->fxx[222]=0.0;
 // j= 2
-    t->fxx[223]=0.0;
-    t->fxx[224]=0.0;
-    t->fxx[225]=0.0;
+    d->fxx[223]=0.0;
+    d->fxx[224]=0.0;
+    d->fxx[225]=0.0;
 // j= 3
-    t->fxx[226]=0.0;
-    t->fxx[227]=0.0;
-    t->fxx[228]=0.0;
+    d->fxx[226]=0.0;
+    d->fxx[227]=0.0;
+    d->fxx[228]=0.0;
 // j= 4
-    t->fxx[230]=0.0;
-    t->fxx[231]=0.0;
-    t->fxx[232]=0.0;
+    d->fxx[230]=0.0;
+    d->fxx[231]=0.0;
+    d->fxx[232]=0.0;
 // j= 5
-    t->fxx[235]=0.0;
-    t->fxx[236]=0.0;
-    t->fxx[237]=0.0;
+    d->fxx[235]=0.0;
+    d->fxx[236]=0.0;
+    d->fxx[237]=0.0;
 // j= 6
-    t->fxx[241]=0.0;
-    t->fxx[242]=0.0;
-    t->fxx[243]=0.0;
-    t->fxx[244]=0.0;
-    t->fxx[245]=0.0;
-    t->fxx[246]=0.0;
-    t->fxx[247]=0.0;
+    d->fxx[241]=0.0;
+    d->fxx[242]=0.0;
+    d->fxx[243]=0.0;
+    d->fxx[244]=0.0;
+    d->fxx[245]=0.0;
+    d->fxx[246]=0.0;
+    d->fxx[247]=0.0;
 // j= 7
-    t->fxx[248]=0.0;
-    t->fxx[249]=0.0;
-    t->fxx[250]=0.0;
-    t->fxx[251]=0.0;
-    t->fxx[252]=0.0;
-    t->fxx[253]=0.0;
-    t->fxx[254]=0.0;
-    t->fxx[255]=0.0;
+    d->fxx[248]=0.0;
+    d->fxx[249]=0.0;
+    d->fxx[250]=0.0;
+    d->fxx[251]=0.0;
+    d->fxx[252]=0.0;
+    d->fxx[253]=0.0;
+    d->fxx[254]=0.0;
+    d->fxx[255]=0.0;
 // j= 8
-    t->fxx[256]=0.0;
-    t->fxx[257]=0.0;
-    t->fxx[258]=0.0;
-    t->fxx[259]=0.0;
-    t->fxx[260]=0.0;
-    t->fxx[261]=0.0;
-    t->fxx[262]=0.0;
-    t->fxx[263]=0.0;
-    t->fxx[264]=0.0;
+    d->fxx[256]=0.0;
+    d->fxx[257]=0.0;
+    d->fxx[258]=0.0;
+    d->fxx[259]=0.0;
+    d->fxx[260]=0.0;
+    d->fxx[261]=0.0;
+    d->fxx[262]=0.0;
+    d->fxx[263]=0.0;
+    d->fxx[264]=0.0;
 // j= 9
-    t->fxx[265]=0.0;
-    t->fxx[266]=0.0;
-    t->fxx[267]=0.0;
-    t->fxx[268]=0.0;
-    t->fxx[269]=0.0;
-    t->fxx[270]=0.0;
-    t->fxx[271]=0.0;
-    t->fxx[272]=0.0;
-    t->fxx[273]=0.0;
-    t->fxx[274]=0.0;
+    d->fxx[265]=0.0;
+    d->fxx[266]=0.0;
+    d->fxx[267]=0.0;
+    d->fxx[268]=0.0;
+    d->fxx[269]=0.0;
+    d->fxx[270]=0.0;
+    d->fxx[271]=0.0;
+    d->fxx[272]=0.0;
+    d->fxx[273]=0.0;
+    d->fxx[274]=0.0;
 // d^2f[5]/dx[i] dx[j]
 // j= 0
-    t->fxx[275]=0.0;
+    d->fxx[275]=0.0;
 // j= 1
-    t->fxx[276]=0.0;
-    t->fxx[277]=0.0;
+    d->fxx[276]=0.0;
+    d->fxx[277]=0.0;
 // j= 2
-    t->fxx[278]=0.0;
-    t->fxx[279]=0.0;
-    t->fxx[280]=0.0;
+    d->fxx[278]=0.0;
+    d->fxx[279]=0.0;
+    d->fxx[280]=0.0;
 // j= 3
-    t->fxx[281]=0.0;
-    t->fxx[282]=0.0;
-    t->fxx[283]=0.0;
+    d->fxx[281]=0.0;
+    d->fxx[282]=0.0;
+    d->fxx[283]=0.0;
 // j= 4
-    t->fxx[285]=0.0;
-    t->fxx[286]=0.0;
-    t->fxx[287]=0.0;
+    d->fxx[285]=0.0;
+    d->fxx[286]=0.0;
+    d->fxx[287]=0.0;
 // j= 5
-    t->fxx[290]=0.0;
-    t->fxx[291]=0.0;
-    t->fxx[292]=0.0;
+    d->fxx[290]=0.0;
+    d->fxx[291]=0.0;
+    d->fxx[292]=0.0;
 // j= 6
-    t->fxx[296]=0.0;
-    t->fxx[297]=0.0;
-    t->fxx[298]=0.0;
-    t->fxx[299]=0.0;
-    t->fxx[300]=0.0;
-    t->fxx[301]=0.0;
-    t->fxx[302]=0.0;
+    d->fxx[296]=0.0;
+    d->fxx[297]=0.0;
+    d->fxx[298]=0.0;
+    d->fxx[299]=0.0;
+    d->fxx[300]=0.0;
+    d->fxx[301]=0.0;
+    d->fxx[302]=0.0;
 // j= 7
-    t->fxx[303]=0.0;
-    t->fxx[304]=0.0;
-    t->fxx[305]=0.0;
-    t->fxx[306]=0.0;
-    t->fxx[307]=0.0;
-    t->fxx[308]=0.0;
-    t->fxx[309]=0.0;
-    t->fxx[310]=0.0;
+    d->fxx[303]=0.0;
+    d->fxx[304]=0.0;
+    d->fxx[305]=0.0;
+    d->fxx[306]=0.0;
+    d->fxx[307]=0.0;
+    d->fxx[308]=0.0;
+    d->fxx[309]=0.0;
+    d->fxx[310]=0.0;
 // j= 8
-    t->fxx[311]=0.0;
-    t->fxx[312]=0.0;
-    t->fxx[313]=0.0;
-    t->fxx[314]=0.0;
-    t->fxx[315]=0.0;
-    t->fxx[316]=0.0;
-    t->fxx[317]=0.0;
-    t->fxx[318]=0.0;
-    t->fxx[319]=0.0;
+    d->fxx[311]=0.0;
+    d->fxx[312]=0.0;
+    d->fxx[313]=0.0;
+    d->fxx[314]=0.0;
+    d->fxx[315]=0.0;
+    d->fxx[316]=0.0;
+    d->fxx[317]=0.0;
+    d->fxx[318]=0.0;
+    d->fxx[319]=0.0;
 // j= 9
-    t->fxx[320]=0.0;
-    t->fxx[321]=0.0;
-    t->fxx[322]=0.0;
-    t->fxx[323]=0.0;
-    t->fxx[324]=0.0;
-    t->fxx[325]=0.0;
-    t->fxx[326]=0.0;
-    t->fxx[327]=0.0;
-    t->fxx[328]=0.0;
-    t->fxx[329]=0.0;
+    d->fxx[320]=0.0;
+    d->fxx[321]=0.0;
+    d->fxx[322]=0.0;
+    d->fxx[323]=0.0;
+    d->fxx[324]=0.0;
+    d->fxx[325]=0.0;
+    d->fxx[326]=0.0;
+    d->fxx[327]=0.0;
+    d->fxx[328]=0.0;
+    d->fxx[329]=0.0;
 // d^2f[6]/dx[i] dx[j]
 // j= 0
-    t->fxx[330]=0.0;
+    d->fxx[330]=0.0;
 // j= 1
-    t->fxx[331]=0.0;
-    t->fxx[332]=0.0;
+    d->fxx[331]=0.0;
+    d->fxx[332]=0.0;
 // j= 2
-    t->fxx[333]=0.0;
-    t->fxx[334]=0.0;
-    t->fxx[335]=0.0;
+    d->fxx[333]=0.0;
+    d->fxx[334]=0.0;
+    d->fxx[335]=0.0;
 // j= 3
-    t->fxx[336]=0.0;
-    t->fxx[337]=0.0;
-    t->fxx[338]=0.0;
-    t->fxx[339]=0.0;
+    d->fxx[336]=0.0;
+    d->fxx[337]=0.0;
+    d->fxx[338]=0.0;
+    d->fxx[339]=0.0;
 // j= 4
-    t->fxx[340]=0.0;
-    t->fxx[341]=0.0;
-    t->fxx[342]=0.0;
-    t->fxx[343]=0.0;
-    t->fxx[344]=0.0;
+    d->fxx[340]=0.0;
+    d->fxx[341]=0.0;
+    d->fxx[342]=0.0;
+    d->fxx[343]=0.0;
+    d->fxx[344]=0.0;
 // j= 5
-    t->fxx[345]=0.0;
-    t->fxx[346]=0.0;
-    t->fxx[347]=0.0;
-    t->fxx[348]=0.0;
-    t->fxx[349]=0.0;
-    t->fxx[350]=0.0;
+    d->fxx[345]=0.0;
+    d->fxx[346]=0.0;
+    d->fxx[347]=0.0;
+    d->fxx[348]=0.0;
+    d->fxx[349]=0.0;
+    d->fxx[350]=0.0;
 // j= 6
-    t->fxx[351]=0.0;
-    t->fxx[352]=0.0;
-    t->fxx[353]=0.0;
-    t->fxx[354]=0.0;
-    t->fxx[355]=0.0;
-    t->fxx[356]=0.0;
-    t->fxx[357]=0.0;
+    d->fxx[351]=0.0;
+    d->fxx[352]=0.0;
+    d->fxx[353]=0.0;
+    d->fxx[354]=0.0;
+    d->fxx[355]=0.0;
+    d->fxx[356]=0.0;
+    d->fxx[357]=0.0;
 // j= 7
-    t->fxx[358]=0.0;
-    t->fxx[359]=0.0;
-    t->fxx[360]=0.0;
-    t->fxx[361]=0.0;
-    t->fxx[362]=0.0;
-    t->fxx[363]=0.0;
-    t->fxx[364]=0.0;
-    t->fxx[365]=0.0;
+    d->fxx[358]=0.0;
+    d->fxx[359]=0.0;
+    d->fxx[360]=0.0;
+    d->fxx[361]=0.0;
+    d->fxx[362]=0.0;
+    d->fxx[363]=0.0;
+    d->fxx[364]=0.0;
+    d->fxx[365]=0.0;
 // j= 8
-    t->fxx[366]=0.0;
-    t->fxx[367]=0.0;
-    t->fxx[368]=0.0;
-    t->fxx[369]=0.0;
-    t->fxx[370]=0.0;
-    t->fxx[371]=0.0;
-    t->fxx[372]=0.0;
-    t->fxx[373]=0.0;
-    t->fxx[374]=0.0;
+    d->fxx[366]=0.0;
+    d->fxx[367]=0.0;
+    d->fxx[368]=0.0;
+    d->fxx[369]=0.0;
+    d->fxx[370]=0.0;
+    d->fxx[371]=0.0;
+    d->fxx[372]=0.0;
+    d->fxx[373]=0.0;
+    d->fxx[374]=0.0;
 // j= 9
-    t->fxx[375]=0.0;
-    t->fxx[376]=0.0;
-    t->fxx[377]=0.0;
-    t->fxx[378]=0.0;
-    t->fxx[379]=0.0;
-    t->fxx[380]=0.0;
-    t->fxx[381]=0.0;
-    t->fxx[382]=0.0;
-    t->fxx[383]=0.0;
-    t->fxx[384]=0.0;
+    d->fxx[375]=0.0;
+    d->fxx[376]=0.0;
+    d->fxx[377]=0.0;
+    d->fxx[378]=0.0;
+    d->fxx[379]=0.0;
+    d->fxx[380]=0.0;
+    d->fxx[381]=0.0;
+    d->fxx[382]=0.0;
+    d->fxx[383]=0.0;
+    d->fxx[384]=0.0;
 // d^2f[7]/dx[i] dx[j]
 // j= 0
-    t->fxx[385]=0.0;
+    d->fxx[385]=0.0;
 // j= 1
-    t->fxx[386]=0.0;
-    t->fxx[387]=0.0;
+    d->fxx[386]=0.0;
+    d->fxx[387]=0.0;
 // j= 2
-    t->fxx[388]=0.0;
-    t->fxx[389]=0.0;
-    t->fxx[390]=0.0;
+    d->fxx[388]=0.0;
+    d->fxx[389]=0.0;
+    d->fxx[390]=0.0;
 // j= 3
-    t->fxx[391]=0.0;
-    t->fxx[392]=0.0;
-    t->fxx[393]=0.0;
-    t->fxx[394]=0.0;
+    d->fxx[391]=0.0;
+    d->fxx[392]=0.0;
+    d->fxx[393]=0.0;
+    d->fxx[394]=0.0;
 // j= 4
-    t->fxx[395]=0.0;
-    t->fxx[396]=0.0;
-    t->fxx[397]=0.0;
-    t->fxx[398]=0.0;
-    t->fxx[399]=0.0;
+    d->fxx[395]=0.0;
+    d->fxx[396]=0.0;
+    d->fxx[397]=0.0;
+    d->fxx[398]=0.0;
+    d->fxx[399]=0.0;
 // j= 5
-    t->fxx[400]=0.0;
-    t->fxx[401]=0.0;
-    t->fxx[402]=0.0;
-    t->fxx[403]=0.0;
-    t->fxx[404]=0.0;
-    t->fxx[405]=0.0;
+    d->fxx[400]=0.0;
+    d->fxx[401]=0.0;
+    d->fxx[402]=0.0;
+    d->fxx[403]=0.0;
+    d->fxx[404]=0.0;
+    d->fxx[405]=0.0;
 // j= 6
-    t->fxx[406]=0.0;
-    t->fxx[407]=0.0;
-    t->fxx[408]=0.0;
-    t->fxx[409]=0.0;
-    t->fxx[410]=0.0;
-    t->fxx[411]=0.0;
-    t->fxx[412]=0.0;
+    d->fxx[406]=0.0;
+    d->fxx[407]=0.0;
+    d->fxx[408]=0.0;
+    d->fxx[409]=0.0;
+    d->fxx[410]=0.0;
+    d->fxx[411]=0.0;
+    d->fxx[412]=0.0;
 // j= 7
-    t->fxx[413]=0.0;
-    t->fxx[414]=0.0;
-    t->fxx[415]=0.0;
-    t->fxx[416]=0.0;
-    t->fxx[417]=0.0;
-    t->fxx[418]=0.0;
-    t->fxx[419]=0.0;
-    t->fxx[420]=0.0;
+    d->fxx[413]=0.0;
+    d->fxx[414]=0.0;
+    d->fxx[415]=0.0;
+    d->fxx[416]=0.0;
+    d->fxx[417]=0.0;
+    d->fxx[418]=0.0;
+    d->fxx[419]=0.0;
+    d->fxx[420]=0.0;
 // j= 8
-    t->fxx[421]=0.0;
-    t->fxx[422]=0.0;
-    t->fxx[423]=0.0;
-    t->fxx[424]=0.0;
-    t->fxx[425]=0.0;
-    t->fxx[426]=0.0;
-    t->fxx[427]=0.0;
-    t->fxx[428]=0.0;
-    t->fxx[429]=0.0;
+    d->fxx[421]=0.0;
+    d->fxx[422]=0.0;
+    d->fxx[423]=0.0;
+    d->fxx[424]=0.0;
+    d->fxx[425]=0.0;
+    d->fxx[426]=0.0;
+    d->fxx[427]=0.0;
+    d->fxx[428]=0.0;
+    d->fxx[429]=0.0;
 // j= 9
-    t->fxx[430]=0.0;
-    t->fxx[431]=0.0;
-    t->fxx[432]=0.0;
-    t->fxx[433]=0.0;
-    t->fxx[434]=0.0;
-    t->fxx[435]=0.0;
-    t->fxx[436]=0.0;
-    t->fxx[437]=0.0;
-    t->fxx[438]=0.0;
-    t->fxx[439]=0.0;
+    d->fxx[430]=0.0;
+    d->fxx[431]=0.0;
+    d->fxx[432]=0.0;
+    d->fxx[433]=0.0;
+    d->fxx[434]=0.0;
+    d->fxx[435]=0.0;
+    d->fxx[436]=0.0;
+    d->fxx[437]=0.0;
+    d->fxx[438]=0.0;
+    d->fxx[439]=0.0;
 // d^2f[8]/dx[i] dx[j]
 // j= 0
-    t->fxx[440]=0.0;
+    d->fxx[440]=0.0;
 // j= 1
-    t->fxx[441]=0.0;
-    t->fxx[442]=0.0;
+    d->fxx[441]=0.0;
+    d->fxx[442]=0.0;
 // j= 2
-    t->fxx[443]=0.0;
-    t->fxx[444]=0.0;
-    t->fxx[445]=0.0;
+    d->fxx[443]=0.0;
+    d->fxx[444]=0.0;
+    d->fxx[445]=0.0;
 // j= 3
-    t->fxx[446]=0.0;
-    t->fxx[447]=0.0;
-    t->fxx[448]=0.0;
-    t->fxx[449]=0.0;
+    d->fxx[446]=0.0;
+    d->fxx[447]=0.0;
+    d->fxx[448]=0.0;
+    d->fxx[449]=0.0;
 // j= 4
-    t->fxx[450]=0.0;
-    t->fxx[451]=0.0;
-    t->fxx[452]=0.0;
-    t->fxx[453]=0.0;
-    t->fxx[454]=0.0;
+    d->fxx[450]=0.0;
+    d->fxx[451]=0.0;
+    d->fxx[452]=0.0;
+    d->fxx[453]=0.0;
+    d->fxx[454]=0.0;
 // j= 5
-    t->fxx[455]=0.0;
-    t->fxx[456]=0.0;
-    t->fxx[457]=0.0;
-    t->fxx[458]=0.0;
-    t->fxx[459]=0.0;
-    t->fxx[460]=0.0;
+    d->fxx[455]=0.0;
+    d->fxx[456]=0.0;
+    d->fxx[457]=0.0;
+    d->fxx[458]=0.0;
+    d->fxx[459]=0.0;
+    d->fxx[460]=0.0;
 // j= 6
-    t->fxx[461]=0.0;
-    t->fxx[462]=0.0;
-    t->fxx[463]=0.0;
-    t->fxx[464]=0.0;
-    t->fxx[465]=0.0;
-    t->fxx[466]=0.0;
-    t->fxx[467]=0.0;
+    d->fxx[461]=0.0;
+    d->fxx[462]=0.0;
+    d->fxx[463]=0.0;
+    d->fxx[464]=0.0;
+    d->fxx[465]=0.0;
+    d->fxx[466]=0.0;
+    d->fxx[467]=0.0;
 // j= 7
-    t->fxx[468]=0.0;
-    t->fxx[469]=0.0;
-    t->fxx[470]=0.0;
-    t->fxx[471]=0.0;
-    t->fxx[472]=0.0;
-    t->fxx[473]=0.0;
-    t->fxx[474]=0.0;
-    t->fxx[475]=0.0;
+    d->fxx[468]=0.0;
+    d->fxx[469]=0.0;
+    d->fxx[470]=0.0;
+    d->fxx[471]=0.0;
+    d->fxx[472]=0.0;
+    d->fxx[473]=0.0;
+    d->fxx[474]=0.0;
+    d->fxx[475]=0.0;
 // j= 8
-    t->fxx[476]=0.0;
-    t->fxx[477]=0.0;
-    t->fxx[478]=0.0;
-    t->fxx[479]=0.0;
-    t->fxx[480]=0.0;
-    t->fxx[481]=0.0;
-    t->fxx[482]=0.0;
-    t->fxx[483]=0.0;
-    t->fxx[484]=0.0;
+    d->fxx[476]=0.0;
+    d->fxx[477]=0.0;
+    d->fxx[478]=0.0;
+    d->fxx[479]=0.0;
+    d->fxx[480]=0.0;
+    d->fxx[481]=0.0;
+    d->fxx[482]=0.0;
+    d->fxx[483]=0.0;
+    d->fxx[484]=0.0;
 // j= 9
-    t->fxx[485]=0.0;
-    t->fxx[486]=0.0;
-    t->fxx[487]=0.0;
-    t->fxx[488]=0.0;
-    t->fxx[489]=0.0;
-    t->fxx[490]=0.0;
-    t->fxx[491]=0.0;
-    t->fxx[492]=0.0;
-    t->fxx[493]=0.0;
-    t->fxx[494]=0.0;
+    d->fxx[485]=0.0;
+    d->fxx[486]=0.0;
+    d->fxx[487]=0.0;
+    d->fxx[488]=0.0;
+    d->fxx[489]=0.0;
+    d->fxx[490]=0.0;
+    d->fxx[491]=0.0;
+    d->fxx[492]=0.0;
+    d->fxx[493]=0.0;
+    d->fxx[494]=0.0;
 // d^2f[9]/dx[i] dx[j]
 // j= 0
-    t->fxx[495]=0.0;
+    d->fxx[495]=0.0;
 // j= 1
-    t->fxx[496]=0.0;
-    t->fxx[497]=0.0;
+    d->fxx[496]=0.0;
+    d->fxx[497]=0.0;
 // j= 2
-    t->fxx[498]=0.0;
-    t->fxx[499]=0.0;
-    t->fxx[500]=0.0;
+    d->fxx[498]=0.0;
+    d->fxx[499]=0.0;
+    d->fxx[500]=0.0;
 // j= 3
-    t->fxx[501]=0.0;
-    t->fxx[502]=0.0;
-    t->fxx[503]=0.0;
-    t->fxx[504]=0.0;
+    d->fxx[501]=0.0;
+    d->fxx[502]=0.0;
+    d->fxx[503]=0.0;
+    d->fxx[504]=0.0;
 // j= 4
-    t->fxx[505]=0.0;
-    t->fxx[506]=0.0;
-    t->fxx[507]=0.0;
-    t->fxx[508]=0.0;
-    t->fxx[509]=0.0;
+    d->fxx[505]=0.0;
+    d->fxx[506]=0.0;
+    d->fxx[507]=0.0;
+    d->fxx[508]=0.0;
+    d->fxx[509]=0.0;
 // j= 5
-    t->fxx[510]=0.0;
-    t->fxx[511]=0.0;
-    t->fxx[512]=0.0;
-    t->fxx[513]=0.0;
-    t->fxx[514]=0.0;
-    t->fxx[515]=0.0;
+    d->fxx[510]=0.0;
+    d->fxx[511]=0.0;
+    d->fxx[512]=0.0;
+    d->fxx[513]=0.0;
+    d->fxx[514]=0.0;
+    d->fxx[515]=0.0;
 // j= 6
-    t->fxx[516]=0.0;
-    t->fxx[517]=0.0;
-    t->fxx[518]=0.0;
-    t->fxx[519]=0.0;
-    t->fxx[520]=0.0;
-    t->fxx[521]=0.0;
-    t->fxx[522]=0.0;
+    d->fxx[516]=0.0;
+    d->fxx[517]=0.0;
+    d->fxx[518]=0.0;
+    d->fxx[519]=0.0;
+    d->fxx[520]=0.0;
+    d->fxx[521]=0.0;
+    d->fxx[522]=0.0;
 // j= 7
-    t->fxx[523]=0.0;
-    t->fxx[524]=0.0;
-    t->fxx[525]=0.0;
-    t->fxx[526]=0.0;
-    t->fxx[527]=0.0;
-    t->fxx[528]=0.0;
-    t->fxx[529]=0.0;
-    t->fxx[530]=0.0;
+    d->fxx[523]=0.0;
+    d->fxx[524]=0.0;
+    d->fxx[525]=0.0;
+    d->fxx[526]=0.0;
+    d->fxx[527]=0.0;
+    d->fxx[528]=0.0;
+    d->fxx[529]=0.0;
+    d->fxx[530]=0.0;
 // j= 8
-    t->fxx[531]=0.0;
-    t->fxx[532]=0.0;
-    t->fxx[533]=0.0;
-    t->fxx[534]=0.0;
-    t->fxx[535]=0.0;
-    t->fxx[536]=0.0;
-    t->fxx[537]=0.0;
-    t->fxx[538]=0.0;
-    t->fxx[539]=0.0;
+    d->fxx[531]=0.0;
+    d->fxx[532]=0.0;
+    d->fxx[533]=0.0;
+    d->fxx[534]=0.0;
+    d->fxx[535]=0.0;
+    d->fxx[536]=0.0;
+    d->fxx[537]=0.0;
+    d->fxx[538]=0.0;
+    d->fxx[539]=0.0;
 // j= 9
-    t->fxx[540]=0.0;
-    t->fxx[541]=0.0;
-    t->fxx[542]=0.0;
-    t->fxx[543]=0.0;
-    t->fxx[544]=0.0;
-    t->fxx[545]=0.0;
-    t->fxx[546]=0.0;
-    t->fxx[547]=0.0;
-    t->fxx[548]=0.0;
-    t->fxx[549]=0.0;
+    d->fxx[540]=0.0;
+    d->fxx[541]=0.0;
+    d->fxx[542]=0.0;
+    d->fxx[543]=0.0;
+    d->fxx[544]=0.0;
+    d->fxx[545]=0.0;
+    d->fxx[546]=0.0;
+    d->fxx[547]=0.0;
+    d->fxx[548]=0.0;
+    d->fxx[549]=0.0;
 
 // d^2f[0]/du[i] du[j]
 // j= 0
-    t->fuu[0]=0.0;
+    d->fuu[0]=0.0;
 // j= 1
-    t->fuu[1]=0.0;
-    t->fuu[2]=0.0;
+    d->fuu[1]=0.0;
+    d->fuu[2]=0.0;
 // d^2f[1]/du[i] du[j]
 // j= 0
-    t->fuu[3]=0.0;
+    d->fuu[3]=0.0;
 // j= 1
-    t->fuu[4]=0.0;
-    t->fuu[5]=0.0;
+    d->fuu[4]=0.0;
+    d->fuu[5]=0.0;
 // d^2f[2]/du[i] du[j]
 // j= 0
-    t->fuu[6]=0.0;
+    d->fuu[6]=0.0;
 // j= 1
-    t->fuu[7]=0.0;
-    t->fuu[8]=0.0;
+    d->fuu[7]=0.0;
+    d->fuu[8]=0.0;
 // d^2f[3]/du[i] du[j]
 // j= 0
 // j= 1
-    t->fuu[10]=0.0;
+    d->fuu[10]=0.0;
 // d^2f[4]/du[i] du[j]
 // j= 0
 // j= 1
-    t->fuu[13]=0.0;
+    d->fuu[13]=0.0;
 // d^2f[5]/du[i] du[j]
 // j= 0
 // j= 1
-    t->fuu[16]=0.0;
+    d->fuu[16]=0.0;
 // d^2f[6]/du[i] du[j]
 // j= 0
-    t->fuu[18]=0.0;
+    d->fuu[18]=0.0;
 // j= 1
-    t->fuu[19]=0.0;
-    t->fuu[20]=0.0;
+    d->fuu[19]=0.0;
+    d->fuu[20]=0.0;
 // d^2f[7]/du[i] du[j]
 // j= 0
-    t->fuu[21]=0.0;
+    d->fuu[21]=0.0;
 // j= 1
-    t->fuu[22]=0.0;
-    t->fuu[23]=0.0;
+    d->fuu[22]=0.0;
+    d->fuu[23]=0.0;
 // d^2f[8]/du[i] du[j]
 // j= 0
-    t->fuu[24]=0.0;
+    d->fuu[24]=0.0;
 // j= 1
-    t->fuu[25]=0.0;
-    t->fuu[26]=0.0;
+    d->fuu[25]=0.0;
+    d->fuu[26]=0.0;
 // d^2f[9]/du[i] du[j]
 // j= 0
-    t->fuu[27]=0.0;
+    d->fuu[27]=0.0;
 // j= 1
-    t->fuu[28]=0.0;
-    t->fuu[29]=0.0;
+    d->fuu[28]=0.0;
+    d->fuu[29]=0.0;
 
 // d^2f[0]/dx[i] du[j]
 // j= 0
-    t->fxu[0]=0.0;
-    t->fxu[1]=0.0;
-    t->fxu[2]=0.0;
-    t->fxu[3]=0.0;
-    t->fxu[4]=0.0;
-    t->fxu[5]=0.0;
-    t->fxu[6]=0.0;
-    t->fxu[7]=0.0;
-    t->fxu[8]=0.0;
-    t->fxu[9]=0.0;
+    d->fxu[0]=0.0;
+    d->fxu[1]=0.0;
+    d->fxu[2]=0.0;
+    d->fxu[3]=0.0;
+    d->fxu[4]=0.0;
+    d->fxu[5]=0.0;
+    d->fxu[6]=0.0;
+    d->fxu[7]=0.0;
+    d->fxu[8]=0.0;
+    d->fxu[9]=0.0;
 // j= 1
-    t->fxu[10]=0.0;
-    t->fxu[11]=0.0;
-    t->fxu[12]=0.0;
-    t->fxu[13]=0.0;
-    t->fxu[14]=0.0;
-    t->fxu[15]=0.0;
-    t->fxu[16]=0.0;
-    t->fxu[17]=0.0;
-    t->fxu[18]=0.0;
-    t->fxu[19]=0.0;
+    d->fxu[10]=0.0;
+    d->fxu[11]=0.0;
+    d->fxu[12]=0.0;
+    d->fxu[13]=0.0;
+    d->fxu[14]=0.0;
+    d->fxu[15]=0.0;
+    d->fxu[16]=0.0;
+    d->fxu[17]=0.0;
+    d->fxu[18]=0.0;
+    d->fxu[19]=0.0;
 // d^2f[1]/dx[i] du[j]
 // j= 0
-    t->fxu[20]=0.0;
-    t->fxu[21]=0.0;
-    t->fxu[22]=0.0;
-    t->fxu[23]=0.0;
-    t->fxu[24]=0.0;
-    t->fxu[25]=0.0;
-    t->fxu[26]=0.0;
-    t->fxu[27]=0.0;
-    t->fxu[28]=0.0;
-    t->fxu[29]=0.0;
+    d->fxu[20]=0.0;
+    d->fxu[21]=0.0;
+    d->fxu[22]=0.0;
+    d->fxu[23]=0.0;
+    d->fxu[24]=0.0;
+    d->fxu[25]=0.0;
+    d->fxu[26]=0.0;
+    d->fxu[27]=0.0;
+    d->fxu[28]=0.0;
+    d->fxu[29]=0.0;
 // j= 1
-    t->fxu[30]=0.0;
-    t->fxu[31]=0.0;
-    t->fxu[32]=0.0;
-    t->fxu[33]=0.0;
-    t->fxu[34]=0.0;
-    t->fxu[35]=0.0;
-    t->fxu[36]=0.0;
-    t->fxu[37]=0.0;
-    t->fxu[38]=0.0;
-    t->fxu[39]=0.0;
+    d->fxu[30]=0.0;
+    d->fxu[31]=0.0;
+    d->fxu[32]=0.0;
+    d->fxu[33]=0.0;
+    d->fxu[34]=0.0;
+    d->fxu[35]=0.0;
+    d->fxu[36]=0.0;
+    d->fxu[37]=0.0;
+    d->fxu[38]=0.0;
+    d->fxu[39]=0.0;
 // d^2f[2]/dx[i] du[j]
 // j= 0
-    t->fxu[40]=0.0;
-    t->fxu[41]=0.0;
-    t->fxu[42]=0.0;
-    t->fxu[43]=0.0;
-    t->fxu[44]=0.0;
-    t->fxu[45]=0.0;
-    t->fxu[46]=0.0;
-    t->fxu[47]=0.0;
-    t->fxu[48]=0.0;
-    t->fxu[49]=0.0;
+    d->fxu[40]=0.0;
+    d->fxu[41]=0.0;
+    d->fxu[42]=0.0;
+    d->fxu[43]=0.0;
+    d->fxu[44]=0.0;
+    d->fxu[45]=0.0;
+    d->fxu[46]=0.0;
+    d->fxu[47]=0.0;
+    d->fxu[48]=0.0;
+    d->fxu[49]=0.0;
 // j= 1
-    t->fxu[50]=0.0;
-    t->fxu[51]=0.0;
-    t->fxu[52]=0.0;
-    t->fxu[53]=0.0;
-    t->fxu[54]=0.0;
-    t->fxu[55]=0.0;
-    t->fxu[56]=0.0;
-    t->fxu[57]=0.0;
-    t->fxu[58]=0.0;
-    t->fxu[59]=0.0;
+    d->fxu[50]=0.0;
+    d->fxu[51]=0.0;
+    d->fxu[52]=0.0;
+    d->fxu[53]=0.0;
+    d->fxu[54]=0.0;
+    d->fxu[55]=0.0;
+    d->fxu[56]=0.0;
+    d->fxu[57]=0.0;
+    d->fxu[58]=0.0;
+    d->fxu[59]=0.0;
 // d^2f[3]/dx[i] du[j]
 // j= 0
-    t->fxu[60]=0.0;
-    t->fxu[61]=0.0;
-    t->fxu[62]=0.0;
-    t->fxu[66]=0.0;
-    t->fxu[67]=0.0;
-    t->fxu[68]=0.0;
-    t->fxu[69]=0.0;
+    d->fxu[60]=0.0;
+    d->fxu[61]=0.0;
+    d->fxu[62]=0.0;
+    d->fxu[66]=0.0;
+    d->fxu[67]=0.0;
+    d->fxu[68]=0.0;
+    d->fxu[69]=0.0;
 // j= 1
-    t->fxu[70]=0.0;
-    t->fxu[71]=0.0;
-    t->fxu[72]=0.0;
-    t->fxu[76]=0.0;
-    t->fxu[77]=0.0;
-    t->fxu[78]=0.0;
-    t->fxu[79]=0.0;
+    d->fxu[70]=0.0;
+    d->fxu[71]=0.0;
+    d->fxu[72]=0.0;
+    d->fxu[76]=0.0;
+    d->fxu[77]=0.0;
+    d->fxu[78]=0.0;
+    d->fxu[79]=0.0;
 // d^2f[4]/dx[i] du[j]
 // j= 0
-    t->fxu[80]=0.0;
-    t->fxu[81]=0.0;
-    t->fxu[82]=0.0;
-    t->fxu[86]=0.0;
-    t->fxu[87]=0.0;
-    t->fxu[88]=0.0;
-    t->fxu[89]=0.0;
+    d->fxu[80]=0.0;
+    d->fxu[81]=0.0;
+    d->fxu[82]=0.0;
+    d->fxu[86]=0.0;
+    d->fxu[87]=0.0;
+    d->fxu[88]=0.0;
+    d->fxu[89]=0.0;
 // j= 1
-    t->fxu[90]=0.0;
-    t->fxu[91]=0.0;
-    t->fxu[92]=0.0;
-    t->fxu[96]=0.0;
-    t->fxu[97]=0.0;
-    t->fxu[98]=0.0;
-    t->fxu[99]=0.0;
+    d->fxu[90]=0.0;
+    d->fxu[91]=0.0;
+    d->fxu[92]=0.0;
+    d->fxu[96]=0.0;
+    d->fxu[97]=0.0;
+    d->fxu[98]=0.0;
+    d->fxu[99]=0.0;
 // d^2f[5]/dx[i] du[j]
 // j= 0
-    t->fxu[100]=0.0;
-    t->fxu[101]=0.0;
-    t->fxu[102]=0.0;
-    t->fxu[106]=0.0;
-    t->fxu[107]=0.0;
-    t->fxu[108]=0.0;
-    t->fxu[109]=0.0;
+    d->fxu[100]=0.0;
+    d->fxu[101]=0.0;
+    d->fxu[102]=0.0;
+    d->fxu[106]=0.0;
+    d->fxu[107]=0.0;
+    d->fxu[108]=0.0;
+    d->fxu[109]=0.0;
 // j= 1
-    t->fxu[110]=0.0;
-    t->fxu[111]=0.0;
-    t->fxu[112]=0.0;
-    t->fxu[116]=0.0;
-    t->fxu[117]=0.0;
-    t->fxu[118]=0.0;
-    t->fxu[119]=0.0;
+    d->fxu[110]=0.0;
+    d->fxu[111]=0.0;
+    d->fxu[112]=0.0;
+    d->fxu[116]=0.0;
+    d->fxu[117]=0.0;
+    d->fxu[118]=0.0;
+    d->fxu[119]=0.0;
 // d^2f[6]/dx[i] du[j]
 // j= 0
-    t->fxu[120]=0.0;
-    t->fxu[121]=0.0;
-    t->fxu[122]=0.0;
-    t->fxu[123]=0.0;
-    t->fxu[124]=0.0;
-    t->fxu[125]=0.0;
-    t->fxu[126]=0.0;
-    t->fxu[127]=0.0;
-    t->fxu[128]=0.0;
-    t->fxu[129]=0.0;
+    d->fxu[120]=0.0;
+    d->fxu[121]=0.0;
+    d->fxu[122]=0.0;
+    d->fxu[123]=0.0;
+    d->fxu[124]=0.0;
+    d->fxu[125]=0.0;
+    d->fxu[126]=0.0;
+    d->fxu[127]=0.0;
+    d->fxu[128]=0.0;
+    d->fxu[129]=0.0;
 // j= 1
-    t->fxu[130]=0.0;
-    t->fxu[131]=0.0;
-    t->fxu[132]=0.0;
-    t->fxu[133]=0.0;
-    t->fxu[134]=0.0;
-    t->fxu[135]=0.0;
-    t->fxu[136]=0.0;
-    t->fxu[137]=0.0;
-    t->fxu[138]=0.0;
-    t->fxu[139]=0.0;
+    d->fxu[130]=0.0;
+    d->fxu[131]=0.0;
+    d->fxu[132]=0.0;
+    d->fxu[133]=0.0;
+    d->fxu[134]=0.0;
+    d->fxu[135]=0.0;
+    d->fxu[136]=0.0;
+    d->fxu[137]=0.0;
+    d->fxu[138]=0.0;
+    d->fxu[139]=0.0;
 // d^2f[7]/dx[i] du[j]
 // j= 0
-    t->fxu[140]=0.0;
-    t->fxu[141]=0.0;
-    t->fxu[142]=0.0;
-    t->fxu[143]=0.0;
-    t->fxu[144]=0.0;
-    t->fxu[145]=0.0;
-    t->fxu[146]=0.0;
-    t->fxu[147]=0.0;
-    t->fxu[148]=0.0;
-    t->fxu[149]=0.0;
+    d->fxu[140]=0.0;
+    d->fxu[141]=0.0;
+    d->fxu[142]=0.0;
+    d->fxu[143]=0.0;
+    d->fxu[144]=0.0;
+    d->fxu[145]=0.0;
+    d->fxu[146]=0.0;
+    d->fxu[147]=0.0;
+    d->fxu[148]=0.0;
+    d->fxu[149]=0.0;
 // j= 1
-    t->fxu[150]=0.0;
-    t->fxu[151]=0.0;
-    t->fxu[152]=0.0;
-    t->fxu[153]=0.0;
-    t->fxu[154]=0.0;
-    t->fxu[155]=0.0;
-    t->fxu[156]=0.0;
-    t->fxu[157]=0.0;
-    t->fxu[158]=0.0;
-    t->fxu[159]=0.0;
+    d->fxu[150]=0.0;
+    d->fxu[151]=0.0;
+    d->fxu[152]=0.0;
+    d->fxu[153]=0.0;
+    d->fxu[154]=0.0;
+    d->fxu[155]=0.0;
+    d->fxu[156]=0.0;
+    d->fxu[157]=0.0;
+    d->fxu[158]=0.0;
+    d->fxu[159]=0.0;
 // d^2f[8]/dx[i] du[j]
 // j= 0
-    t->fxu[160]=0.0;
-    t->fxu[161]=0.0;
-    t->fxu[162]=0.0;
-    t->fxu[163]=0.0;
-    t->fxu[164]=0.0;
-    t->fxu[165]=0.0;
-    t->fxu[166]=0.0;
-    t->fxu[167]=0.0;
-    t->fxu[168]=0.0;
-    t->fxu[169]=0.0;
+    d->fxu[160]=0.0;
+    d->fxu[161]=0.0;
+    d->fxu[162]=0.0;
+    d->fxu[163]=0.0;
+    d->fxu[164]=0.0;
+    d->fxu[165]=0.0;
+    d->fxu[166]=0.0;
+    d->fxu[167]=0.0;
+    d->fxu[168]=0.0;
+    d->fxu[169]=0.0;
 // j= 1
-    t->fxu[170]=0.0;
-    t->fxu[171]=0.0;
-    t->fxu[172]=0.0;
-    t->fxu[173]=0.0;
-    t->fxu[174]=0.0;
-    t->fxu[175]=0.0;
-    t->fxu[176]=0.0;
-    t->fxu[177]=0.0;
-    t->fxu[178]=0.0;
-    t->fxu[179]=0.0;
+    d->fxu[170]=0.0;
+    d->fxu[171]=0.0;
+    d->fxu[172]=0.0;
+    d->fxu[173]=0.0;
+    d->fxu[174]=0.0;
+    d->fxu[175]=0.0;
+    d->fxu[176]=0.0;
+    d->fxu[177]=0.0;
+    d->fxu[178]=0.0;
+    d->fxu[179]=0.0;
 // d^2f[9]/dx[i] du[j]
 // j= 0
-    t->fxu[180]=0.0;
-    t->fxu[181]=0.0;
-    t->fxu[182]=0.0;
-    t->fxu[183]=0.0;
-    t->fxu[184]=0.0;
-    t->fxu[185]=0.0;
-    t->fxu[186]=0.0;
-    t->fxu[187]=0.0;
-    t->fxu[188]=0.0;
-    t->fxu[189]=0.0;
+    d->fxu[180]=0.0;
+    d->fxu[181]=0.0;
+    d->fxu[182]=0.0;
+    d->fxu[183]=0.0;
+    d->fxu[184]=0.0;
+    d->fxu[185]=0.0;
+    d->fxu[186]=0.0;
+    d->fxu[187]=0.0;
+    d->fxu[188]=0.0;
+    d->fxu[189]=0.0;
 // j= 1
-    t->fxu[190]=0.0;
-    t->fxu[191]=0.0;
-    t->fxu[192]=0.0;
-    t->fxu[193]=0.0;
-    t->fxu[194]=0.0;
-    t->fxu[195]=0.0;
-    t->fxu[196]=0.0;
-    t->fxu[197]=0.0;
-    t->fxu[198]=0.0;
-    t->fxu[199]=0.0;
+    d->fxu[190]=0.0;
+    d->fxu[191]=0.0;
+    d->fxu[192]=0.0;
+    d->fxu[193]=0.0;
+    d->fxu[194]=0.0;
+    d->fxu[195]=0.0;
+    d->fxu[196]=0.0;
+    d->fxu[197]=0.0;
+    d->fxu[198]=0.0;
+    d->fxu[199]=0.0;
 #endif
     }
     
@@ -4951,7 +5270,6 @@ static int init_final(trajFin_t *t, tOptSet *o) {
 }
 
 int init_trajectory(traj_t *t, tOptSet *o) {
-    if(!init_running(t->t, o)) return 0;
     if(!init_final(&t->f, o)) return 0;
     
     return 1;
@@ -4987,11 +5305,13 @@ int init_multipliers(tOptSet *o) {
 int init_opt(tOptSet *o) {
     int i;
     
-    for(i= 0; i<NUMBER_OF_THREADS+1; i++)
+    // the constant entries of the running derivatives are only set once
+    if(!init_running(o->derivs, o)) return 0;
+    for(i= 0; i<N_CANDIDATES+1; i++)
         if(!init_trajectory(&o->trajectories[i], o)) return 0;
 
     o->nominal= &o->trajectories[0];
-    for(i= 1; i<NUMBER_OF_THREADS+1; i++)
+    for(i= 1; i<N_CANDIDATES+1; i++)
     o->candidates[i-1]= &o->trajectories[i];
     
     if(!init_multipliers(o)) return 0;
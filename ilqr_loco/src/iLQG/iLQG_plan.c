@@ -9,16 +9,100 @@ double* assignPtrVal(double* values, int numVal) {
     return temp;
 }
 
-void init_params(tOptSet *o, double* xDes, double* Obs)
+// Obs holds n_obs obstacles as x, y pairs. p[3] and p[25] come from
+// alloc_solver, only the first o->obs_capacity obstacles are used.
+void init_params(tOptSet *o, double* xDes, double* Obs, int n_obs)
 {
-    o->p[3] = assignPtrVal(Obs,2);
-    o->p[25] = assignPtrVal(xDes,6);
+    if(n_obs>o->obs_capacity)
+        n_obs= o->obs_capacity;
+    if(n_obs>0)
+        memcpy(o->p[3], Obs, 2*n_obs*sizeof(double));
+    o->n_obs= n_obs;
+    memcpy(o->p[25], xDes, 6*sizeof(double));
 }
 
-void plan_trajectory(double* x0, double* u0, double* xDes, double* Obs, int T, tOptSet *o, struct trajectory* Traj)
+// o->obs_capacity is the number of obstacles a plan may have, at least 1
+int alloc_solver(tOptSet *o, int T)
+{
+    int i;
+
+    // buffers already sized for this horizon are reused as they are
+    if(o->trajectories[0].t!=NULL && o->n_hor==T)
+        return 1;
+
+    free_solver(o);
+
+    for(i= 0; i<N_CANDIDATES+1; i++) {
+        o->trajectories[i].t= (trajEl_t *) malloc(sizeof(trajEl_t)*T);
+        if(o->trajectories[i].t==NULL) {
+            while(i-->0) {
+                free(o->trajectories[i].t);
+                o->trajectories[i].t= NULL;
+            }
+            return 0;
+        }
+    }
+    o->derivs= (derivEl_t *) malloc(sizeof(derivEl_t)*T);
+    o->multipliers.t= (multipliersEl_t *) malloc(sizeof(multipliersEl_t)*(T+1));
+    o->obs_capacity= max(o->obs_capacity, 1);
+    o->p[3]= (double *) malloc(2*o->obs_capacity*sizeof(double));
+    o->p[25]= (double *) malloc(6*sizeof(double));
+    o->n_allocs+= N_CANDIDATES+5;
+#if MULTI_THREADED
+    o->chunk_done= (int *) malloc(sizeof(int)*((T + DERIVS_CHUNK - 1)/DERIVS_CHUNK));
+    o->n_allocs++;
+    pthread_mutex_init(&o->step_mutex, NULL);
+    pthread_cond_init(&o->next_step_condition, NULL);
+#endif
+    o->n_hor= T;
+
+    if(o->derivs==NULL || o->multipliers.t==NULL || o->p[3]==NULL || o->p[25]==NULL) {
+        free_solver(o);
+        return 0;
+    }
+#if MULTI_THREADED
+    if(o->chunk_done==NULL) {
+        free_solver(o);
+        return 0;
+    }
+#endif
+
+    return 1;
+}
+
+void free_solver(tOptSet *o)
+{
+    int i;
+
+    if(o->trajectories[0].t==NULL)
+        return;
+
+#if MULTI_THREADED
+    pthread_cond_destroy(&o->next_step_condition);
+    pthread_mutex_destroy(&o->step_mutex);
+    free(o->chunk_done);
+    o->chunk_done= NULL;
+#endif
+    for(i= 0; i<N_CANDIDATES+1; i++) {
+        free(o->trajectories[i].t);
+        o->trajectories[i].t= NULL;
+    }
+    free(o->derivs);
+    o->derivs= NULL;
+    free(o->multipliers.t);
+    o->multipliers.t= NULL;
+    free(o->p[3]);
+    free(o->p[25]);
+    o->p[3]= o->p[25]= NULL;
+    o->n_hor= 0;
+}
+
+// deadline is an absolute monotonic_time() after which the solver returns
+// its best trajectory so far with ILQG_DEADLINE, <= 0 for no deadline
+int plan_trajectory(double* x0, double* u0, double* xDes, double* Obs, int n_obs, int T, double deadline, tOptSet *o, struct trajectory* Traj)
 {
     // dims
-    int N, n, m, m_, n_, si, i, k;
+    int N, m_, n_, si, i, k;
 
     // inputs
     int dims[3];
@@ -27,33 +111,36 @@ void plan_trajectory(double* x0, double* u0, double* xDes, double* Obs, int T, t
     double *x_nom, *u_nom; //, *l, *L;
 
     // aux
-    clock_t begin, end;
+    double begin, end;
+    double plan_start= monotonic_time();
+    long allocs= o->n_allocs;
 
-    n= sizeof(x0)/sizeof(x0[0]);  // length of state vector
-    m= 2; // number of inputs
+    // state and input sizes are N_X and N_U of the generated problem
     N= T+1;
 
     // inputs
     o->x0= x0; //double *
     u_nom= u0;  // double **
-    o->n_hor= N-1;
+    o->deadline= deadline;
+    if(o->stats!=NULL) {
+        o->stats->n_iter= 0;
+        o->stats->t_derivs= o->stats->t_back_pass= o->stats->t_line_search= 0.0;
+    }
 
     standard_parameters(o);
-    // Set model and problem parameters
-    init_params(o, xDes, Obs);
 
     // outputs
-    double success[1];
+    int status;
     double new_cost[1];
 
     // aux
-    for(i= 0; i<NUMBER_OF_THREADS+1; i++)
-        o->trajectories[i].t= (trajEl_t *) malloc(sizeof(trajEl_t)*(N-1));
-    o->multipliers.t= (multipliersEl_t *) malloc(sizeof(multipliersEl_t)*N);
-
     // printf("Set const vars\n");
-    if(!init_opt(o)) {
-        success[0]= 0;
+    int allocated= alloc_solver(o, N-1);
+    // Set model and problem parameters, into the buffers of alloc_solver
+    if(allocated)
+        init_params(o, xDes, Obs, n_obs);
+    if(!allocated || !init_opt(o)) {
+        status= ILQG_FAILED;
         new_cost[0]= o->cost;
     } else {
         // printf("Initializing trajectory\n");
@@ -62,16 +149,16 @@ void plan_trajectory(double* x0, double* u0, double* xDes, double* Obs, int T, t
                 o->nominal->t[k].u[i]= u_nom[MAT_IDX(i, k, N_U)];
         if(!forward_pass(o->candidates[0], o, 0.0, &o->cost, 0)) {
             printf("forward_pass failed\n");
-            success[0]= 0;
+            status= ILQG_FAILED;
             new_cost[0]= o->cost;
         } else {
             makeCandidateNominal(o, 0);
 
             printf("Starting iLQG\n");
-            begin = clock();
-            success[0]= iLQG(o);
-            end = clock();
-            printf("Time for iLQG: %f seconds\n", (double)(end - begin) / CLOCKS_PER_SEC);
+            begin = monotonic_time();
+            status= iLQG(o);
+            end = monotonic_time();
+            printf("Time for iLQG: %f seconds\n", end - begin);
             for(k= 0; k<N-1; k++)
                 for(i= 0; i<N_X; i++)
                     Traj->x[MAT_IDX(i, k, N_X)]= o->nominal->t[k].x[i];
@@ -86,6 +173,12 @@ void plan_trajectory(double* x0, double* u0, double* xDes, double* Obs, int T, t
         }
     }
 
-    for(i= 0; i<NUMBER_OF_THREADS+1; i++)
-        free(o->trajectories[i].t);
+    if(o->stats!=NULL) {
+        o->stats->status= status;
+        o->stats->cost= new_cost[0];
+        o->stats->n_allocs= o->n_allocs - allocs;
+        o->stats->t_total= monotonic_time() - plan_start;
+    }
+
+    return status;
 }
@@ -30,35 +30,107 @@
 #define printMat_(x) do { if (DEBUG_FORWARDPASS) printMat x; } while (0)
 
 
+// one batch of the line search: candidate j is rolled out with alpha[first+j],
+// task idx rolls out candidates idx*n_lanes.. in the lanes of forward_pass_batch
+typedef struct {
+    tOptSet *o;
+    int first;
+    int n_batch;
+    int n_lanes;
+    double cost[N_CANDIDATES];
+    int success[N_CANDIDATES];
+} lsBatch_t;
+
+static void rollout_candidates(void *arg, int idx) {
+    lsBatch_t *b= (lsBatch_t *) arg;
+    int j= idx*b->n_lanes;
+    int n= b->n_batch - j;
+
+    if(n>b->n_lanes) n= b->n_lanes;
+    forward_pass_batch(b->o->candidates+j, b->o, b->o->alpha+b->first+j, n, b->cost+j, b->success+j);
+}
+
 int line_search(tOptSet *o, int iter) {
-    double expected, z, alpha, dcost, cnew;
-    int i, success;
+    double expected= 0.0, z= 0.0, alpha, dcost= 0.0, cnew= 0.0;
+    double e, z_;
+    int i, j, n_batch, n_tasks, max_tasks, best, success;
+    traj_t *temp;
+    lsBatch_t b;
 
-    for(i= 0; i < o->n_alpha; i++) {
-        alpha= o->alpha[i];
+    // The alphas are tried in batches of N_CANDIDATES, spread evenly over
+    // the threads of the pool. The lowest cost accepted candidate of the
+    // first batch with any accepted candidate wins, equal costs going to the
+    // smaller alpha index. The batches do not depend on the pool size, so
+    // neither does the result.
+    b.o= o;
+    best= -1;
+    i= 0;
+    max_tasks= thread_pool_size(o->pool);
+    if(max_tasks>NUMBER_OF_THREADS) max_tasks= NUMBER_OF_THREADS;
+    for(b.first= 0; b.first < o->n_alpha && best<0; b.first+= n_batch) {
+        n_batch= o->n_alpha - b.first;
+        if(n_batch>N_CANDIDATES) n_batch= N_CANDIDATES;
+        // with a deadline the alphas take at least two batches, so the
+        // clock is read before the smaller steps are rolled out
+        if(o->deadline>0.0 && n_batch>(o->n_alpha+1)/2) n_batch= (o->n_alpha+1)/2;
+        b.n_batch= n_batch;
+        b.n_lanes= (n_batch + max_tasks - 1)/max_tasks;
+        if(b.n_lanes>ROLLOUT_LANES) b.n_lanes= ROLLOUT_LANES;
+        n_tasks= (n_batch + b.n_lanes - 1)/b.n_lanes;
 
-        success= forward_pass(o->candidates[0], o, alpha, &cnew, 0);
-        if(success) {
-            dcost= o->cost - cnew;
-            expected= -alpha*(o->dV[0] + alpha*o->dV[1]);
-			// printf("dV: %f %f, expected: %f, alpha: %f\n", o->dV[0], o->dV[1], expected, alpha);
-            if(expected > 0)
-                z = dcost/expected;
+        thread_pool_run(o->pool, rollout_candidates, &b, n_tasks);
+
+        for(j= 0; j<n_batch; j++) {
+            alpha= o->alpha[b.first+j];
+            if(!b.success[j]) {
+                if(o->debug_level>=2) {
+                    TRACE(("line search: %-3d: prediction or objective failed with inf or nan\n", b.first+j+1));
+                }
+                continue;
+            }
+
+            e= -alpha*(o->dV[0] + alpha*o->dV[1]);
+			// printf("dV: %f %f, expected: %f, alpha: %f\n", o->dV[0], o->dV[1], e, alpha);
+            if(e > 0)
+                z_= (o->cost - b.cost[j])/e;
             else {
-                z= 0;
+                z_= 0;
                 TRACE(("non-positive expected reduction: should not occur (dV[0]= %g, dV[1]= %g)\n", o->dV[0], o->dV[1]));
             }
 
-            if(z > o->zMin)
-                break;
-            else
-                success= 0;
-        } else {
+            if(z_ > o->zMin) {
+                if(best>=0 && b.cost[j]>=cnew)
+                    continue;
+                best= j;
+            } else if(best>=0) {
+                continue;
+            }
+            // until one is accepted, the last candidate rolled out is reported
+            i= b.first+j;
+            cnew= b.cost[j];
+            dcost= o->cost - cnew;
+            expected= e;
+            z= z_;
+        }
+
+        // smaller steps are not worth waiting for once the deadline is gone
+        if(best<0 && o->deadline>0.0 && monotonic_time()>=o->deadline) {
             if(o->debug_level>=2) {
-                TRACE(("line search: %-3d: prediction or objective failed with inf or nan\n", i+1));
+                TRACE(("line search: deadline reached after %d alphas\n", b.first+n_batch));
             }
+            break;
         }
     }
+    success= (best>=0);
+    if(!success)
+        i= o->n_alpha;
+
+    // iLQG() accepts candidates[0]
+    if(best>0) {
+        temp= o->candidates[0];
+        o->candidates[0]= o->candidates[best];
+        o->candidates[best]= temp;
+    }
 
     if(o->debug_level>=2) {
         if(!success) {
@@ -71,6 +143,7 @@ int line_search(tOptSet *o, int iter) {
     if(o->log_linesearch!=NULL) o->log_linesearch[iter]= i+1;
     if(o->log_z!=NULL) o->log_z[iter]= z;
     if(o->log_cost!=NULL) o->log_cost[iter]= cnew;
+    if(o->stats!=NULL && iter<o->stats->max_iter) o->stats->iter[iter].alpha_idx= success? i: -1;
     o->new_cost= cnew;
     o->dcost= dcost;
     o->expected= expected;
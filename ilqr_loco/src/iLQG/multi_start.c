@@ -0,0 +1,168 @@
+// Multi-start iLQG: the same problem solved from several seeds in parallel.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "multi_start.h"
+
+#if MULTI_THREADED
+#define MS_LOCK(ms)   pthread_mutex_lock(&(ms)->mutex)
+#define MS_UNLOCK(ms) pthread_mutex_unlock(&(ms)->mutex)
+#else
+#define MS_LOCK(ms)
+#define MS_UNLOCK(ms)
+#endif
+
+// stop_check of every start: give up once another start has finished clearly lower
+static int losing_start(tOptSet *o, void *arg) {
+    multiStart_t *ms= (multiStart_t *) arg;
+    int lose;
+
+    MS_LOCK(ms);
+    lose= ms->n_finished>0 && o->cost > ms->best_finished_cost + ms->cancel_margin;
+    MS_UNLOCK(ms);
+
+    return lose;
+}
+
+static void solve_start(void *arg, int idx) {
+    multiStart_t *ms= (multiStart_t *) arg;
+    msStart_t *s= &ms->starts[idx];
+
+    // plan_trajectory reads the seed before it writes the solution
+    s->status= plan_trajectory(ms->x0, s->traj.u, ms->xDes, ms->Obs, ms->n_obs, ms->n_hor, ms->deadline, &s->opt, &s->traj);
+
+    if(s->status!=ILQG_FAILED && s->status!=ILQG_CANCELLED) {
+        MS_LOCK(ms);
+        if(ms->n_finished==0 || s->opt.cost < ms->best_finished_cost)
+            ms->best_finished_cost= s->opt.cost;
+        ms->n_finished++;
+        MS_UNLOCK(ms);
+    }
+}
+
+// proto provides parameters and options, cancel_margin= INF never cancels
+multiStart_t *multi_start_create(const tOptSet *proto, int n_starts, int T, double cancel_margin) {
+    multiStart_t *ms;
+    msStart_t *s;
+    int i, j;
+
+    ms= (multiStart_t *) calloc(1, sizeof(multiStart_t));
+    if(ms==NULL)
+        return NULL;
+    ms->starts= (msStart_t *) calloc(n_starts, sizeof(msStart_t));
+    if(ms->starts==NULL) {
+        free(ms);
+        return NULL;
+    }
+    ms->n_starts= n_starts;
+    ms->n_hor= T;
+    ms->cancel_margin= cancel_margin;
+#if MULTI_THREADED
+    pthread_mutex_init(&ms->mutex, NULL);
+#endif
+
+    for(i= 0; i<n_starts; i++) {
+        s= &ms->starts[i];
+
+        s->opt= *proto;
+        for(j= 0; j<N_CANDIDATES+1; j++)
+            s->opt.trajectories[j].t= NULL;
+        s->opt.derivs= NULL;
+        s->opt.multipliers.t= NULL;
+        s->opt.n_hor= 0;
+        s->opt.pool= NULL;
+        s->opt.stop_check= losing_start;
+        s->opt.stop_arg= ms;
+        s->opt.n_allocs= 0;
+
+        // every start records into its own stats
+        s->opt.stats= NULL;
+        if(proto->stats!=NULL) {
+            s->stats.max_iter= proto->stats->max_iter;
+            s->stats.iter= (iterStats_t *) calloc(s->stats.max_iter, sizeof(iterStats_t));
+            if(s->stats.iter==NULL) {
+                ms->n_starts= i+1;
+                multi_start_destroy(ms);
+                return NULL;
+            }
+            s->opt.stats= &s->stats;
+        }
+
+        s->p= (double **) malloc(n_params*sizeof(double *));
+        s->traj.x= (double *) malloc(N_X*(T+1)*sizeof(double));
+        s->traj.u= (double *) malloc(N_U*T*sizeof(double));
+        if(s->p==NULL || s->traj.x==NULL || s->traj.u==NULL) {
+            ms->n_starts= i+1;
+            multi_start_destroy(ms);
+            return NULL;
+        }
+        // obstacles and xDes get buffers of their own from alloc_solver
+        memcpy(s->p, proto->p, n_params*sizeof(double *));
+        s->p[3]= NULL;
+        s->p[25]= NULL;
+        s->opt.p= s->p;
+
+        if(!alloc_solver(&s->opt, T)) {
+            ms->n_starts= i+1;
+            multi_start_destroy(ms);
+            return NULL;
+        }
+    }
+
+    return ms;
+}
+
+void multi_start_destroy(multiStart_t *ms) {
+    msStart_t *s;
+    int i;
+
+    if(ms==NULL)
+        return;
+
+    for(i= 0; i<ms->n_starts; i++) {
+        s= &ms->starts[i];
+        free_solver(&s->opt);
+        free(s->p);
+        free(s->traj.x);
+        free(s->traj.u);
+        free(s->stats.iter);
+    }
+#if MULTI_THREADED
+    pthread_mutex_destroy(&ms->mutex);
+#endif
+    free(ms->starts);
+    free(ms);
+}
+
+// seed buffer of start idx, N_U x T, to be filled before multi_start_plan
+double *multi_start_seed(multiStart_t *ms, int idx) {
+    return ms->starts[idx].traj.u;
+}
+
+// Returns the status of the lowest cost start, its index in *best and its
+// solution in ms->starts[*best].traj; ILQG_FAILED if no start produced one.
+int multi_start_plan(multiStart_t *ms, double* x0, double* xDes, double* Obs, int n_obs, double deadline, threadPool_t *pool, int *best) {
+    msStart_t *s;
+    int i;
+
+    ms->x0= x0;
+    ms->xDes= xDes;
+    ms->Obs= Obs;
+    ms->n_obs= n_obs;
+    ms->deadline= deadline;
+    ms->n_finished= 0;
+
+    thread_pool_run(pool, solve_start, ms, ms->n_starts);
+
+    *best= -1;
+    for(i= 0; i<ms->n_starts; i++) {
+        s= &ms->starts[i];
+        if(s->status==ILQG_FAILED)
+            continue;
+        if(*best<0 || s->opt.cost < ms->starts[*best].opt.cost)
+            *best= i;
+    }
+
+    return (*best<0)? ILQG_FAILED: ms->starts[*best].status;
+}
@@ -0,0 +1,173 @@
+// Memory mapped library of converged iLQG solutions with nearest neighbour
+// lookup by start state and obstacle.
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "primitive_cache.h"
+
+// keys start on a cache line
+#define PC_KEYS_OFFSET 64
+
+static void make_key(double key[PC_KEY_DIM], const double *x0, const double *Obs) {
+    int i;
+
+    for(i= 0; i<6; i++)
+        key[i]= x0[i];
+    key[6]= Obs[0];
+    key[7]= Obs[1];
+}
+
+// normalized squared distance
+static double key_dist2(const double *a, const double *b, const double *scale) {
+    double d, s= 0.0;
+    int i;
+
+    for(i= 0; i<PC_KEY_DIM; i++) {
+        d= (a[i] - b[i])/scale[i];
+        s+= d*d;
+    }
+    return s;
+}
+
+static size_t map_size(int T, int capacity) {
+    return PC_KEYS_OFFSET + (size_t) capacity*(PC_KEY_DIM + 1 + N_U*T + N_X*(T+1))*sizeof(double);
+}
+
+// Maps path, creating or resetting it if it was made for another problem
+// size. scale normalizes each key dimension. Returns NULL on failure.
+primitiveCache_t *primitive_cache_open(const char *path, int T, int capacity, const double *scale, double merge_dist) {
+    primitiveCache_t *pc;
+    struct stat st;
+    pcHeader_t *h;
+    size_t size= map_size(T, capacity);
+    int fd, fresh;
+
+    if(sizeof(pcHeader_t) > PC_KEYS_OFFSET || capacity<1)
+        return NULL;
+
+    fd= open(path, O_RDWR | O_CREAT, 0644);
+    if(fd<0)
+        return NULL;
+    if(fstat(fd, &st) || (st.st_size!=(off_t) size && ftruncate(fd, size))) {
+        close(fd);
+        return NULL;
+    }
+    fresh= (st.st_size!=(off_t) size);
+
+    pc= (primitiveCache_t *) calloc(1, sizeof(primitiveCache_t));
+    if(pc==NULL) {
+        close(fd);
+        return NULL;
+    }
+    pc->map= mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if(pc->map==MAP_FAILED) {
+        free(pc);
+        return NULL;
+    }
+    pc->map_size= size;
+
+    h= pc->header= (pcHeader_t *) pc->map;
+    if(fresh || memcmp(h->magic, PC_MAGIC, sizeof(PC_MAGIC)) || h->n_x!=N_X || h->n_u!=N_U ||
+       h->T!=T || h->capacity!=capacity || h->count<0 || h->count>capacity ||
+       h->next<0 || h->next>=capacity) {
+        memset(h, 0, PC_KEYS_OFFSET);
+        memcpy(h->magic, PC_MAGIC, sizeof(PC_MAGIC));
+        h->n_x= N_X;
+        h->n_u= N_U;
+        h->T= T;
+        h->capacity= capacity;
+    }
+
+    pc->keys= (double *) ((char *) pc->map + PC_KEYS_OFFSET);
+    pc->entries= pc->keys + capacity*PC_KEY_DIM;
+    pc->stride= 1 + N_U*T + N_X*(T+1);
+    memcpy(pc->scale, scale, PC_KEY_DIM*sizeof(double));
+    pc->merge_dist= merge_dist;
+
+    return pc;
+}
+
+void primitive_cache_close(primitiveCache_t *pc) {
+    if(pc==NULL)
+        return;
+    munmap(pc->map, pc->map_size);
+    free(pc);
+}
+
+// Index of the entry closest to x0 and Obs, its normalized distance in
+// *dist; -1 if the library is empty.
+int primitive_cache_nearest(const primitiveCache_t *pc, const double *x0, const double *Obs, double *dist) {
+    double key[PC_KEY_DIM], d, best_d= INF;
+    int i, best= -1;
+
+    make_key(key, x0, Obs);
+    // a linear scan over the packed keys beats a tree for a few thousand entries
+    for(i= 0; i<pc->header->count; i++) {
+        d= key_dist2(pc->keys + i*PC_KEY_DIM, key, pc->scale);
+        if(d<best_d) {
+            best_d= d;
+            best= i;
+        }
+    }
+    *dist= sqrt(best_d);
+
+    return best;
+}
+
+const double *primitive_cache_u(const primitiveCache_t *pc, int idx) {
+    return pc->entries + idx*pc->stride + 1;
+}
+
+const double *primitive_cache_x(const primitiveCache_t *pc, int idx) {
+    return pc->entries + idx*pc->stride + 1 + N_U*pc->header->T;
+}
+
+double primitive_cache_cost(const primitiveCache_t *pc, int idx) {
+    return pc->entries[idx*pc->stride];
+}
+
+// Adds a converged solution. It replaces an entry within merge_dist, else
+// goes to a free slot or, once the library is full, to the oldest one.
+// Costs of solves from different start states do not compare, so the newer
+// of two close solutions is kept: it was solved with the current parameters.
+void primitive_cache_insert(primitiveCache_t *pc, const double *x0, const double *Obs, double cost, const double *u, const double *x) {
+    pcHeader_t *h= pc->header;
+    double dist, *e, *key;
+    int i, idx, append= 0;
+
+    idx= primitive_cache_nearest(pc, x0, Obs, &dist);
+    if(idx>=0 && dist<pc->merge_dist) {
+        // replaced in place
+    } else if(h->count < h->capacity) {
+        idx= h->count;
+        append= 1;
+    } else {
+        idx= h->next;
+        h->next= (h->next+1) % h->capacity;
+    }
+
+    // A write cut short must not leave a key that points at another
+    // solution: the old key is voided first, a NaN key is never nearest, and
+    // the new one written once the entry is complete. An appended slot is
+    // counted only then.
+    key= pc->keys + idx*PC_KEY_DIM;
+    for(i= 0; i<PC_KEY_DIM; i++)
+        key[i]= NAN;
+    __sync_synchronize();
+    e= pc->entries + idx*pc->stride;
+    e[0]= cost;
+    memcpy(e + 1, u, N_U*h->T*sizeof(double));
+    memcpy(e + 1 + N_U*h->T, x, N_X*(h->T+1)*sizeof(double));
+    __sync_synchronize();
+    make_key(key, x0, Obs);
+    if(append) {
+        __sync_synchronize();
+        h->count++;
+    }
+}
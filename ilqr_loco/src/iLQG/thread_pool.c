@@ -0,0 +1,176 @@
+// Persistent worker pool used to spread independent parts of an iLQG
+// iteration (line search rollouts, derivatives) over several cores.
+
+#include <stdlib.h>
+
+#include "iLQG.h"
+#include "thread_pool.h"
+
+#if MULTI_THREADED
+
+struct threadPool {
+    pthread_t *threads;
+    int n_threads;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t work_cond;
+    pthread_cond_t done_cond;
+
+    poolTask_t task;
+    void *arg;
+    int n_tasks;
+    int next_task;
+    int n_done;
+    int shutdown;
+};
+
+// runs tasks of the current batch until none are left; mutex must be held
+static void run_tasks(threadPool_t *tp) {
+    int idx;
+
+    while(tp->next_task < tp->n_tasks) {
+        idx= tp->next_task++;
+        pthread_mutex_unlock(&tp->mutex);
+
+        tp->task(tp->arg, idx);
+
+        pthread_mutex_lock(&tp->mutex);
+        if(++tp->n_done==tp->n_tasks)
+            pthread_cond_broadcast(&tp->done_cond);
+    }
+}
+
+static void *worker_function(void *arg) {
+    threadPool_t *tp= (threadPool_t *) arg;
+
+    pthread_mutex_lock(&tp->mutex);
+    while(!tp->shutdown) {
+        if(tp->next_task < tp->n_tasks)
+            run_tasks(tp);
+        else
+            pthread_cond_wait(&tp->work_cond, &tp->mutex);
+    }
+    pthread_mutex_unlock(&tp->mutex);
+
+    return NULL;
+}
+
+threadPool_t *thread_pool_create(int n_workers) {
+    threadPool_t *tp;
+    int i;
+
+    if(n_workers<1)
+        return NULL;
+
+    tp= (threadPool_t *) calloc(1, sizeof(threadPool_t));
+    if(tp==NULL)
+        return NULL;
+    tp->threads= (pthread_t *) malloc(n_workers*sizeof(pthread_t));
+    if(tp->threads==NULL) {
+        free(tp);
+        return NULL;
+    }
+
+    pthread_mutex_init(&tp->mutex, NULL);
+    pthread_cond_init(&tp->work_cond, NULL);
+    pthread_cond_init(&tp->done_cond, NULL);
+
+    for(i= 0; i<n_workers; i++) {
+        if(pthread_create(&tp->threads[i], NULL, worker_function, tp))
+            break;
+    }
+    tp->n_threads= i;
+
+    if(tp->n_threads==0) {
+        thread_pool_destroy(tp);
+        return NULL;
+    }
+
+    return tp;
+}
+
+void thread_pool_destroy(threadPool_t *tp) {
+    int i;
+
+    if(tp==NULL)
+        return;
+
+    pthread_mutex_lock(&tp->mutex);
+    tp->shutdown= 1;
+    pthread_cond_broadcast(&tp->work_cond);
+    pthread_mutex_unlock(&tp->mutex);
+
+    for(i= 0; i<tp->n_threads; i++)
+        pthread_join(tp->threads[i], NULL);
+
+    pthread_cond_destroy(&tp->done_cond);
+    pthread_cond_destroy(&tp->work_cond);
+    pthread_mutex_destroy(&tp->mutex);
+    free(tp->threads);
+    free(tp);
+}
+
+// number of tasks that run at once, including the calling thread
+int thread_pool_size(const threadPool_t *tp) {
+    return (tp==NULL)? 1: tp->n_threads+1;
+}
+
+void thread_pool_start(threadPool_t *tp, poolTask_t task, void *arg, int n_tasks) {
+    int i;
+
+    if(tp==NULL) {
+        for(i= 0; i<n_tasks; i++)
+            task(arg, i);
+        return;
+    }
+
+    pthread_mutex_lock(&tp->mutex);
+    tp->task= task;
+    tp->arg= arg;
+    tp->n_done= 0;
+    tp->next_task= 0;
+    tp->n_tasks= n_tasks;
+    pthread_cond_broadcast(&tp->work_cond);
+    pthread_mutex_unlock(&tp->mutex);
+}
+
+void thread_pool_wait(threadPool_t *tp) {
+    if(tp==NULL)
+        return;
+
+    pthread_mutex_lock(&tp->mutex);
+    run_tasks(tp);
+    while(tp->n_done < tp->n_tasks)
+        pthread_cond_wait(&tp->done_cond, &tp->mutex);
+    pthread_mutex_unlock(&tp->mutex);
+}
+
+#else
+
+threadPool_t *thread_pool_create(int n_workers) {
+    return NULL;
+}
+
+void thread_pool_destroy(threadPool_t *tp) {
+}
+
+int thread_pool_size(const threadPool_t *tp) {
+    return 1;
+}
+
+void thread_pool_start(threadPool_t *tp, poolTask_t task, void *arg, int n_tasks) {
+    int i;
+
+    for(i= 0; i<n_tasks; i++)
+        task(arg, i);
+}
+
+void thread_pool_wait(threadPool_t *tp) {
+}
+
+#endif
+
+void thread_pool_run(threadPool_t *tp, poolTask_t task, void *arg, int n_tasks) {
+    thread_pool_start(tp, task, arg, n_tasks);
+    thread_pool_wait(tp);
+}
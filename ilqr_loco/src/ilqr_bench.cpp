@@ -0,0 +1,296 @@
+//
+// MIT License
+//
+// Copyright (c) 2017 MRSD Team D - LoCo
+// The Robotics Institute, Carnegie Mellon University
+// http://mrsdprojects.ri.cmu.edu/2016teamd/
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+// Offline benchmark of the iLQG planner. Solves recorded scenarios with the
+// configuration and seeds traj_client would use, without a car, and writes
+// one CSV line per scenario. Given a baseline CSV from an earlier run it
+// exits with 1 if a scenario stopped converging, got more expensive or slower.
+//
+// A scenario is a namespace under bench_scenarios/ with
+//   x0: [x, y, yaw, Ux, Uy, r]   start state
+//   obstacles: [x, y, ...]       may be empty
+//   x_des: [...]                 optional, X_des otherwise
+// traj_client appends one for every plan it solves to scenario_log_file.
+// Every run warm starts from init_control_seq. See launch/ilqr_bench.launch.
+
+#include "traj_client.h"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <map>
+
+struct BenchResult
+{
+  std::string name;
+  int runs;
+  int status;           // of the last run
+  int iterations;
+  int rejected;         // iterations whose step was rejected
+  double cost;
+  double t_p50, t_p90, t_p99, t_max;
+};
+
+class IlqrBench : public TrajClient
+{
+public:
+  IlqrBench();
+  int Run();
+
+protected:
+  void PublishSolverStats(const solveStats_t &stats, int seed);
+
+private:
+  bool LoadScenario(const std::string &name, nav_msgs::Odometry &x_start, std::vector<double> &x_des,
+                    std::vector<geometry_msgs::Point> &obstacles);
+  BenchResult RunScenario(const std::string &name);
+  void WriteResults(const std::vector<BenchResult> &results);
+  int CompareBaseline(const std::vector<BenchResult> &results);
+
+  int runs_;
+  std::string output_file_;
+  std::string baseline_file_;     // empty for no comparison
+  double cost_tol_;               // relative cost increase that fails
+  double time_tol_;               // relative median time increase that fails, < 0 to ignore time
+
+  // stats of the last plan, recorded instead of published
+  int last_status_;
+  int last_iterations_;
+  int last_rejected_;
+  double last_cost_;
+};
+
+static double Percentile(const std::vector<double> &sorted, double q)
+{
+  int idx = (int)ceil(q*sorted.size()) - 1;
+  return sorted[std::min(std::max(idx, 0), (int)sorted.size() - 1)];
+}
+
+IlqrBench::IlqrBench()
+{
+  TRYGETPARAM("bench_runs", runs_)
+  TRYGETPARAM("bench_output", output_file_)
+  TRYGETPARAM("bench_baseline", baseline_file_)
+  TRYGETPARAM("bench_cost_tol", cost_tol_)
+  TRYGETPARAM("bench_time_tol", time_tol_)
+  runs_ = std::max(runs_, 1);
+}
+
+void IlqrBench::PublishSolverStats(const solveStats_t &stats, int seed)
+{
+  last_status_ = stats.status;
+  last_iterations_ = stats.n_iter;
+  last_cost_ = stats.cost;
+  last_rejected_ = 0;
+  for (int i = 0; i < stats.n_iter; i++)
+    if (stats.iter[i].alpha_idx < 0)
+      last_rejected_++;
+}
+
+bool IlqrBench::LoadScenario(const std::string &name, nav_msgs::Odometry &x_start, std::vector<double> &x_des,
+                             std::vector<geometry_msgs::Point> &obstacles)
+{
+  std::string ns = "bench_scenarios/" + name + "/";
+  std::vector<double> x0, obs;
+  if (!nh.getParam(ns + "x0", x0) || x0.size() != 6)
+  {
+    ROS_ERROR("Scenario %s needs x0 with 6 entries, skipping it.", name.c_str());
+    return false;
+  }
+  nh.getParam(ns + "obstacles", obs);
+  if (!nh.getParam(ns + "x_des", x_des))
+    x_des = x_des_;
+
+  x_start.pose.pose.position.x = x0[0];
+  x_start.pose.pose.position.y = x0[1];
+  x_start.pose.pose.orientation = tf::createQuaternionMsgFromYaw(x0[2]);
+  x_start.twist.twist.linear.x = x0[3];
+  x_start.twist.twist.linear.y = x0[4];
+  x_start.twist.twist.angular.z = x0[5];
+
+  obstacles.resize(obs.size()/2);
+  for (int i = 0; i < obstacles.size(); i++)
+  {
+    obstacles[i].x = obs[2*i];
+    obstacles[i].y = obs[2*i+1];
+  }
+  return true;
+}
+
+BenchResult IlqrBench::RunScenario(const std::string &name)
+{
+  // a scenario that does not load is written as failed, with no runs
+  BenchResult r = BenchResult();
+  r.name = name;
+  r.status = ILQG_FAILED;
+
+  nav_msgs::Odometry x_start;
+  std::vector<double> x_des;
+  std::vector<geometry_msgs::Point> obstacles;
+  if (!LoadScenario(name, x_start, x_des, obstacles))
+    return r;
+
+  // one untimed run first, so every timed run starts with warm caches
+  std::vector<double> times;
+  for (int run = 0; run <= runs_; run++)
+  {
+    std::vector<double> u_init = init_control_seq_;
+    // a failed solve publishes no stats
+    last_status_ = ILQG_FAILED;
+    last_iterations_ = 0;
+    last_rejected_ = 0;
+    last_cost_ = 0.0;
+    double begin = monotonic_time();
+    GenTrajILQR(x_start, u_init, x_des, obstacles);
+    if (run > 0)
+      times.push_back(monotonic_time() - begin);
+  }
+
+  std::sort(times.begin(), times.end());
+  r.runs = times.size();
+  r.status = last_status_;
+  r.iterations = last_iterations_;
+  r.rejected = last_rejected_;
+  r.cost = last_cost_;
+  r.t_p50 = Percentile(times, 0.5);
+  r.t_p90 = Percentile(times, 0.9);
+  r.t_p99 = Percentile(times, 0.99);
+  r.t_max = times.back();
+  return r;
+}
+
+void IlqrBench::WriteResults(const std::vector<BenchResult> &results)
+{
+  FILE *f = fopen(output_file_.c_str(), "w");
+  if (f == NULL)
+  {
+    ROS_ERROR("Could not open %s, writing results to stdout.", output_file_.c_str());
+    f = stdout;
+  }
+
+  fprintf(f, "scenario,runs,status,iterations,rejected,cost,t_p50,t_p90,t_p99,t_max\n");
+  for (int i = 0; i < results.size(); i++)
+  {
+    const BenchResult &r = results[i];
+    fprintf(f, "%s,%d,%d,%d,%d,%.9g,%.6f,%.6f,%.6f,%.6f\n", r.name.c_str(), r.runs, r.status,
+            r.iterations, r.rejected, r.cost, r.t_p50, r.t_p90, r.t_p99, r.t_max);
+  }
+
+  if (f != stdout)
+    fclose(f);
+}
+
+// Returns the number of scenarios that got worse than in the baseline
+int IlqrBench::CompareBaseline(const std::vector<BenchResult> &results)
+{
+  std::ifstream in(baseline_file_.c_str());
+  if (!in)
+  {
+    ROS_ERROR("Could not read baseline %s.", baseline_file_.c_str());
+    return 1;
+  }
+
+  std::map<std::string, BenchResult> baseline;
+  std::string line;
+  std::getline(in, line); // header
+  while (std::getline(in, line))
+  {
+    BenchResult b = BenchResult();
+    std::replace(line.begin(), line.end(), ',', ' ');
+    std::istringstream ss(line);
+    if (ss >> b.name >> b.runs >> b.status >> b.iterations >> b.rejected >> b.cost
+           >> b.t_p50 >> b.t_p90 >> b.t_p99 >> b.t_max)
+      baseline[b.name] = b;
+  }
+
+  int n_worse = 0;
+  for (int i = 0; i < results.size(); i++)
+  {
+    const BenchResult &r = results[i];
+    std::map<std::string, BenchResult>::const_iterator it = baseline.find(r.name);
+    if (it == baseline.end())
+      continue;
+    const BenchResult &b = it->second;
+
+    if (r.runs == 0 || (r.status != ILQG_CONVERGED && b.status == ILQG_CONVERGED) || r.status == ILQG_FAILED)
+    {
+      ROS_ERROR("%s: status %d, was %d.", r.name.c_str(), r.status, b.status);
+      n_worse++;
+    }
+    else if (r.cost > b.cost + cost_tol_*std::max(1.0, fabs(b.cost)))
+    {
+      ROS_ERROR("%s: cost %f, was %f.", r.name.c_str(), r.cost, b.cost);
+      n_worse++;
+    }
+    else if (time_tol_ >= 0 && r.t_p50 > b.t_p50*(1 + time_tol_))
+    {
+      ROS_ERROR("%s: median time %f s, was %f s.", r.name.c_str(), r.t_p50, b.t_p50);
+      n_worse++;
+    }
+  }
+  return n_worse;
+}
+
+int IlqrBench::Run()
+{
+  XmlRpc::XmlRpcValue scenarios;
+  if (!nh.getParam("bench_scenarios", scenarios) || scenarios.getType() != XmlRpc::XmlRpcValue::TypeStruct)
+  {
+    ROS_FATAL("No scenarios under bench_scenarios.");
+    return 1;
+  }
+
+  std::vector<BenchResult> results;
+  for (XmlRpc::XmlRpcValue::iterator it = scenarios.begin(); it != scenarios.end() && ros::ok(); ++it)
+  {
+    results.push_back(RunScenario(it->first));
+    const BenchResult &r = results.back();
+    if (r.runs > 0)
+      ROS_INFO("%s: status %d, %d iterations, cost %f, median %.4f s.", r.name.c_str(), r.status,
+               r.iterations, r.cost, r.t_p50);
+  }
+  WriteResults(results);
+
+  if (baseline_file_.empty())
+    return 0;
+  int n_worse = CompareBaseline(results);
+  if (n_worse > 0)
+    ROS_ERROR("%d scenarios regressed against %s.", n_worse, baseline_file_.c_str());
+  else
+    ROS_INFO("No regressions against %s.", baseline_file_.c_str());
+  return n_worse > 0;
+}
+
+int main(int argc, char** argv)
+{
+  ros::init(argc, argv, "ilqr_bench");
+  IlqrBench bench;
+  if (!ros::ok())
+    return 1;
+
+  int ret = bench.Run();
+  ros::shutdown();
+  return ret;
+}
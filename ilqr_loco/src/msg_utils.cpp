@@ -26,75 +26,92 @@
 
 #include "traj_client.h"
 
-void TrajClient::FillGoalMsgHeader(ilqr_loco::TrajExecGoal &goal)
+// Trajectory of n_commands commands with one state each, header filled in
+loco_msgs::TrajectoryPtr TrajClient::NewTrajectory(int n_commands, int n_x)
 {
-  goal.traj.header.seq = T_;
-  goal.traj.header.stamp = ros::Time::now();
-  goal.traj.header.frame_id = "base_link";
-  goal.traj.timestep = timestep_;
+  loco_msgs::TrajectoryPtr traj(new loco_msgs::Trajectory);
+  traj->header.seq = T_;
+  traj->header.stamp = ros::Time::now();
+  traj->header.frame_id = "base_link";
+  traj->timestep = timestep_;
+  traj->n_x = n_x;
+  traj->n_u = 2;
+  traj->x.resize(n_x*n_commands);
+  traj->u.resize(2*n_commands);
+  return traj;
 }
 
-void TrajClient::FillTwistMsg(geometry_msgs::Twist &twist, double lin_x, double ang_z)
+void TrajClient::SetCommand(loco_msgs::Trajectory &traj, int i, double lin_x, double ang_z)
 {
-  twist.linear.x = lin_x;
-  twist.angular.z = ang_z;
+  traj.u[i*traj.n_u+0] = lin_x;
+  traj.u[i*traj.n_u+1] = ang_z;
 }
 
-void TrajClient::FillOdomMsg(nav_msgs::Odometry &odom, double x, double y,
-                             double yaw, double Ux, double Uy, double w)
+void TrajClient::SetState(loco_msgs::Trajectory &traj, int i, double x, double y,
+                          double yaw, double Ux, double Uy, double w)
 {
-  odom.pose.pose.position.x = x;
-  odom.pose.pose.position.y = y;
-  odom.pose.pose.position.z = 0.0;
-
-  geometry_msgs::Quaternion odom_quat = tf::createQuaternionMsgFromYaw(yaw);
-  odom.pose.pose.orientation = odom_quat;
+  double *state = &traj.x[i*traj.n_x];
+  state[0] = x;
+  state[1] = y;
+  state[2] = yaw;
+  state[3] = Ux;
+  state[4] = Uy;
+  state[5] = w;
+}
 
-  odom.twist.twist.linear.x = Ux;
-  odom.twist.twist.linear.y = Uy;
-  odom.twist.twist.angular.z = w;
+void TrajClient::SetState(loco_msgs::Trajectory &traj, int i, const nav_msgs::Odometry &odom)
+{
+  SetState(traj, i, odom.pose.pose.position.x, odom.pose.pose.position.y,
+           tf::getYaw(odom.pose.pose.orientation), odom.twist.twist.linear.x,
+           odom.twist.twist.linear.y, odom.twist.twist.angular.z);
 }
 
-void TrajClient::SendZeroCommand()
+void TrajClient::SendZeroCommand(const nav_msgs::Odometry &state)
 {
   mode_ = 0;
 
-  ilqr_loco::TrajExecGoal end_goal;
-
-  FillGoalMsgHeader(end_goal);
-  geometry_msgs::Twist control_msg;
-  FillTwistMsg(control_msg, 0, 0);
-
-  end_goal.traj.commands.push_back(control_msg);
-  end_goal.traj.states.push_back(cur_state_);
-  SendTrajectory(end_goal);
+  loco_msgs::TrajectoryPtr end_traj = NewTrajectory(1, 6);
+  SetCommand(*end_traj, 0, 0, 0);
+  SetState(*end_traj, 0, state);
+  SendTrajectory(end_traj);
   ROS_INFO("Sent zero command.");
 }
 
 void TrajClient::SendInitControlSeq()
 {
-  ilqr_loco::TrajExecGoal goal;
-  FillGoalMsgHeader(goal);
-  geometry_msgs::Twist control_msg;
+  int n = init_control_seq_.size()/2;
+  loco_msgs::TrajectoryPtr traj = NewTrajectory(n+1, 6);
 
-  for (int i=0; i<(init_control_seq_.size()/2); i++)
+  for (int i=0; i<n; i++)
   {
-    FillTwistMsg(control_msg, init_control_seq_[2*i], init_control_seq_[(2*i)+1]);
-    goal.traj.commands.push_back(control_msg);
-    goal.traj.states.push_back(cur_state_);
+    SetCommand(*traj, i, init_control_seq_[2*i], init_control_seq_[(2*i)+1]);
+    SetState(*traj, i, cur_state_);
   }
-  FillTwistMsg(control_msg, 0, 0);
-  goal.traj.commands.push_back(control_msg);
-  goal.traj.states.push_back(cur_state_);
+  SetCommand(*traj, n, 0, 0);
+  SetState(*traj, n, cur_state_);
 
-  SendTrajectory(goal);
+  SendTrajectory(traj);
 }
 
-void TrajClient::SendTrajectory(ilqr_loco::TrajExecGoal &goal)
+// traj must not be modified after this, the executor may still hold it
+void TrajClient::SendTrajectory(const loco_msgs::TrajectoryConstPtr &traj)
 {
   // ROS_INFO("Sending trajectory.");
-  // ac_.sendGoal(goal);
+  {
+    std::lock_guard<std::mutex> lock(last_traj_mutex_);
+    last_traj_ = traj;
+  }
+
+  if (executor_)
+  {
+    executor_->Submit(traj);
+    return;
+  }
 
+  ilqr_loco::TrajExecGoal goal;
+  goal.traj = *traj;
+  // planner thread and ROS callbacks both send goals
+  std::lock_guard<std::mutex> lock(ac_mutex_);
   ac_.sendGoal(goal,
                NULL,
                NULL,
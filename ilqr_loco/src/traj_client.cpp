@@ -31,13 +31,17 @@
 #define DUMMYOBSSTATE {obs_pos_.x = 2.599635; obs_pos_.y = 0.365210; cur_state_.pose.pose.position.x = 1.826; cur_state_.pose.pose.position.y = 0.340; double theta = 0.0032; cur_state_.pose.pose.orientation = tf::createQuaternionMsgFromYaw(theta); cur_state_.twist.twist.linear.x = 0.062; cur_state_.twist.twist.linear.y = -0.009; cur_state_.twist.twist.angular.z = 0.00023;}
 
 
-TrajClient::TrajClient(): ac_("traj_server", true), mode_(0), T_(0),
-                          cur_integral_(0), prev_error_(0), step_on_last_traj_(0)
+TrajClient::TrajClient(): ac_("traj_server", true), executor_(NULL), mode_(0), T_(0),
+                          cur_integral_(0), prev_error_(0), step_on_last_traj_(0),
+                          multi_start_(NULL), primitive_cache_(NULL), solver_log_(NULL), scenario_log_(NULL), scenario_count_(0), plan_request_(-1),
+                          reset_seq_(true), planner_shutdown_(false), latency_probe_(0)
 {
   state_sub_  = nh.subscribe("odometry/filtered", 1, &TrajClient::stateCb, this);
   obs_sub_ = nh.subscribe("cluster_center", 1, &TrajClient::obsCb, this);
+  obstacles_sub_ = nh.subscribe("obstacles", 1, &TrajClient::obstaclesCb, this);
   mode_sub_ = nh.subscribe("client_command", 1, &TrajClient::modeCb, this);
   predicted_state_pub_ = nh.advertise<nav_msgs::Odometry>("odometry/predicted", 1);
+  solver_stats_pub_ = nh.advertise<loco_msgs::SolverStats>("ilqr/solver_stats", 10);
 
   state_estimate_received_ = false;
   obs_received_ = false;
@@ -45,9 +49,33 @@ TrajClient::TrajClient(): ac_("traj_server", true), mode_(0), T_(0),
 
   LoadParams();
 
-  ROS_INFO("Waiting for action server to start.");
-  ac_.waitForServer(); //will wait for infinite time
-  ROS_INFO("Action client started. Send me commands from keyboard_command!");
+  if (exec_in_process_)
+  {
+    // Plans are handed to the executor by pointer, no action server involved
+    executor_ = new TrajExecutor(boost::bind(&TrajClient::executorFeedbackCb, this, _1, _2));
+    ROS_INFO("Executing trajectories in process. Send me commands from keyboard_command!");
+  }
+  else
+  {
+    ROS_INFO("Waiting for action server to start.");
+    ac_.waitForServer(); //will wait for infinite time
+    ROS_INFO("Action client started. Send me commands from keyboard_command!");
+  }
+
+  planner_thread_ = std::thread(&TrajClient::PlannerLoop, this);
+}
+
+TrajClient::~TrajClient()
+{
+  {
+    std::lock_guard<std::mutex> lock(planner_mutex_);
+    planner_shutdown_ = true;
+  }
+  planner_cond_.notify_one();
+  if (planner_thread_.joinable())
+    planner_thread_.join();
+  delete executor_;
+  primitive_cache_close(primitive_cache_);
 }
 
 void TrajClient::stateCb(const nav_msgs::Odometry &msg)
@@ -56,6 +84,7 @@ void TrajClient::stateCb(const nav_msgs::Odometry &msg)
 
   prev_state_ = cur_state_;
   cur_state_ = msg;
+  state_mailbox_.Post(msg);
 
   if (T_ == 0)
   {
@@ -63,7 +92,6 @@ void TrajClient::stateCb(const nav_msgs::Odometry &msg)
     prev_error_ = 0;
     start_state_ = cur_state_;
     ramp_start_y_ = start_state_.pose.pose.position.y;
-    u_seq_saved_ = init_control_seq_;
     start_time_ = ros::Time::now();
   }
 
@@ -79,23 +107,51 @@ void TrajClient::obsCb(const geometry_msgs::PointStamped &msg)
     ROS_INFO("Received obstacle message.");
     obs_pos_.x = msg.point.x;
     obs_pos_.y = msg.point.y;
-    obs_received_ = true;
-
-    if (mode_ == 1)
-      SendZeroCommand(); //brake
-    else if (mode_ == 2)
-      PlanFromExtrapolatedILQR();
-    else if (mode_==3 || mode_==7)
-      PlanFromCurrentStateILQR();
-    else if (mode_==4 || mode_==5 || mode_==11)
-      MpcILQR();
-    else if (mode_==6)
-      FixedRateReplanILQR();
-    else if (mode_==13)
-      SendInitControlSeq();
+    obstacles_.assign(1, obs_pos_);
+    ObstaclesReceived();
   }
 }
 
+// All obstacles the tracker currently sees, in the map frame
+void TrajClient::obstaclesCb(const geometry_msgs::PoseArray &msg)
+{
+  obstacles_.resize(msg.poses.size());
+  for (int i = 0; i < msg.poses.size(); i++)
+    obstacles_[i] = msg.poses[i].position;
+
+  // later plans no longer avoid obstacles that are gone
+  if (obstacles_.empty())
+  {
+    obs_mailbox_.Post(obstacles_);
+    return;
+  }
+
+  ROS_INFO("Received %d obstacles.", (int)obstacles_.size());
+  ObstaclesReceived();
+}
+
+void TrajClient::ObstaclesReceived()
+{
+  obs_received_ = true;
+  obs_mailbox_.Post(obstacles_);
+
+  if (mode_ == 1)
+    SendZeroCommand(cur_state_); //brake
+  else if (mode_==2 || mode_==3 || mode_==4 || mode_==5 || mode_==6 || mode_==7 || mode_==11)
+    RequestPlan(mode_); // solved on the planner thread
+  else if (mode_==13)
+    SendInitControlSeq();
+}
+
+void TrajClient::RequestPlan(int mode)
+{
+  {
+    std::lock_guard<std::mutex> lock(planner_mutex_);
+    plan_request_ = mode;
+  }
+  planner_cond_.notify_one();
+}
+
 void TrajClient::modeCb(const geometry_msgs::Point &msg)
 {
   int command = msg.x;
@@ -110,6 +166,7 @@ void TrajClient::modeCb(const geometry_msgs::Point &msg)
   }
 
   T_ = 0;
+  reset_seq_ = true;
 
   switch (command)
   {
@@ -121,9 +178,9 @@ void TrajClient::modeCb(const geometry_msgs::Point &msg)
 			      mode_ = 2;
             #if ILQRDEBUG
             DUMMYOBS
-            u_seq_saved_ = init_control_seq_;
-            PlanFromCurrentStateILQR();
-            mode_ = 0;
+            obs_mailbox_.Post(std::vector<geometry_msgs::Point>(1, obs_pos_));
+            state_mailbox_.Post(cur_state_);
+            RequestPlan(3);
             #endif
 
             break;
@@ -133,8 +190,9 @@ void TrajClient::modeCb(const geometry_msgs::Point &msg)
 
             #if ILQRDEBUG
             DUMMYOBS
-            MpcILQR();
-            mode_ = 0;
+            obs_mailbox_.Post(std::vector<geometry_msgs::Point>(1, obs_pos_));
+            state_mailbox_.Post(cur_state_);
+            RequestPlan(4);
             #endif
             break;
             //wait for stateCb to ramp
@@ -156,7 +214,7 @@ void TrajClient::modeCb(const geometry_msgs::Point &msg)
             obs_received_ = false;
             break;
     case 9: ROS_INFO("Sending zero and killing node.");
-            SendZeroCommand();
+            SendZeroCommand(cur_state_);
             ros::shutdown();
             break;
     case 10: ROS_INFO("Play back initial control sequence.");
@@ -175,15 +233,23 @@ void TrajClient::modeCb(const geometry_msgs::Point &msg)
 
 void TrajClient::feedbackCb(const ilqr_loco::TrajExecFeedbackConstPtr& feedback)
 {
-  // Keeps track of progress of TrajAction server along most recently sent trajectory
+  // Keeps track of progress of TrajAction server along most recently sent trajectory.
+  // The server only publishes feedback on the trajectory of the active goal,
+  // and the action client only passes on that of the goal sent last.
   step_on_last_traj_ = feedback->step;
+  RecordLatency(feedback->step);
 }
 
-int main(int argc, char** argv)
+void TrajClient::executorFeedbackCb(const loco_msgs::TrajectoryConstPtr &traj, int step)
 {
-  ros::init(argc, argv, "traj_client");
-  TrajClient client;
-  ros::spin();
-
-  return 0;
+  // Until the last plan sent takes over, the executor reports steps on the
+  // one before. Those would shift the new plan's warm start and bias the
+  // latency estimate.
+  {
+    std::lock_guard<std::mutex> lock(last_traj_mutex_);
+    if (traj != last_traj_)
+      return;
+  }
+  step_on_last_traj_ = step;
+  RecordLatency(step);
 }
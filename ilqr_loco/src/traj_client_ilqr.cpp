@@ -25,13 +25,12 @@
 //
 
 #include "traj_client.h"
+#include <algorithm>
 
-ilqr_loco::TrajExecGoal TrajClient::GenTrajILQR(nav_msgs::Odometry &x_start, std::vector<double> &u_init,
-                                  std::vector<double> &x_des, geometry_msgs::Point &obstacle_pos)
+loco_msgs::TrajectoryPtr TrajClient::GenTrajILQR(nav_msgs::Odometry &x_start, std::vector<double> &u_init,
+                                  std::vector<double> &x_des, const std::vector<geometry_msgs::Point> &obstacles)
 {
   // ROS_INFO("Generating iLQG trajectory.");
-  ilqr_loco::TrajExecGoal goal;
-  FillGoalMsgHeader(goal);
 
   // ROS_INFO("Start state (before prediction): %f, %f, %f, %f, %f, %f",
   //         cur_state_.pose.pose.position.x, cur_state_.pose.pose.position.y, theta,
@@ -46,89 +45,197 @@ ilqr_loco::TrajExecGoal TrajClient::GenTrajILQR(nav_msgs::Odometry &x_start, std
                    u_init[0], u_init[1], 0, 0};
 
   double* xDes = &x_des[0]; //std::vector trick to convert vector to C-style array
-  double* u0 = &u_init[0];
-  double Obs[2] = {(double)obstacle_pos.x, (double)obstacle_pos.y};
 
-  int N = T_horizon_+1;
-  int n = 10; //state size
-  int m = 2;  //control size
-
-  //Run iLQR trajectory generation
-  struct trajectory Traj;
-  Traj.x = (double *) malloc(n*N*sizeof(double));
-  Traj.u = (double *) malloc(m*(N-1)*sizeof(double));
+  // Obstacles as x, y pairs, the solver has room for the max_obstacles
+  // nearest the start
+  int n_obs = obstacles.size();
+  plan_obs_order_.resize(n_obs);
+  for (int i = 0; i < n_obs; i++)
+  {
+    double dx = obstacles[i].x - x0[0], dy = obstacles[i].y - x0[1];
+    plan_obs_order_[i] = std::make_pair(dx*dx + dy*dy, i);
+  }
+  if (n_obs > max_obstacles_)
+  {
+    std::nth_element(plan_obs_order_.begin(), plan_obs_order_.begin() + max_obstacles_, plan_obs_order_.end());
+    ROS_WARN_THROTTLE(5, "%d obstacles, planning around the %d nearest.", n_obs, max_obstacles_);
+    n_obs = max_obstacles_;
+  }
+  plan_obs_xy_.resize(2*n_obs);
+  for (int i = 0; i < n_obs; i++)
+  {
+    plan_obs_xy_[2*i] = obstacles[plan_obs_order_[i].second].x;
+    plan_obs_xy_[2*i+1] = obstacles[plan_obs_order_[i].second].y;
+  }
+  double* Obs = n_obs ? &plan_obs_xy_[0] : NULL;
+
+  // The primitive cache is keyed on a single obstacle, plans without one use
+  // one far ahead like DUMMYOBS. A solution around several obstacles says
+  // little about a start that only matches one of them, so those plans
+  // neither read nor fill the cache.
+  bool use_cache = primitive_cache_ && n_obs <= 1;
+  double obs_key[2] = {999, 0};
+  if (n_obs == 1)
+  {
+    obs_key[0] = plan_obs_xy_[0];
+    obs_key[1] = plan_obs_xy_[1];
+  }
 
-  plan_trajectory(x0, u0, xDes, Obs, T_horizon_, &Opt, &Traj);
+  int N = T_horizon_+1;
+  int n = N_X; //state size
+  int m = N_U; //control size
 
-  // TODO find better way that doesn't copy twice
-  std::vector<double> u_sol(Traj.u, Traj.u+(2*T_horizon_));
-  u_init = u_sol;
-  std::vector<double> x_sol(Traj.x, Traj.x+(n*N));
-  x_traj_saved_ = x_sol;
+  // The solver writes its states straight into the message, which then goes
+  // to the executor as it is. One command per state: the N-1 planned ones
+  // plus a zero command to stop the vehicle.
+  loco_msgs::TrajectoryPtr traj = NewTrajectory(N, n);
+  traj->start_state = x_start;
 
-  //Put states and controls into format that action client wants.
-  goal.traj.states.reserve(N);
-  goal.traj.commands.reserve(N);
+  //Run iLQR trajectory generation
+  // plan_trajectory only reads u0 before it writes Traj.u, so the solved
+  // controls go straight back into u_init, the warm start of the next plan.
+  u_init.resize(m*(N-1));
 
-  for(int i=0; i<N; i++) {
-   	nav_msgs::Odometry odom;
-    FillOdomMsg(odom, Traj.x[i*n+0], Traj.x[i*n+1], Traj.x[i*n+2],
-                      Traj.x[i*n+3], Traj.x[i*n+4], Traj.x[i*n+5]);
-  	goal.traj.states.push_back(odom);
+  // Warm start from the closest solution solved before, if close enough
+  if (use_cache)
+  {
+    double dist;
+    int idx = primitive_cache_nearest(primitive_cache_, x0, obs_key, &dist);
+    if (idx >= 0 && dist <= primitive_cache_max_dist_)
+    {
+      const double *u_cached = primitive_cache_u(primitive_cache_, idx);
+      std::copy(u_cached, u_cached + m*(N-1), u_init.begin());
+      ROS_DEBUG("Warm start from cached primitive %d at distance %f.", idx, dist);
+    }
   }
 
-  for(int i=0; i<N-1; i++) {
-  	geometry_msgs::Twist twist;
-    FillTwistMsg(twist, double(Traj.u[i*m+0]), double(Traj.u[i*m+1]));
-  	goal.traj.commands.push_back(twist);
+  struct trajectory Traj;
+  Traj.x = &traj->x[0];
+  Traj.u = &u_init[0];
+
+  double deadline = (ilqr_max_time_ > 0) ? monotonic_time() + ilqr_max_time_ : 0.0;
+  int status;
+  int iterations = 0;
+  solveStats_t *stats = Opt.stats;
+  int seed = 0;
+  double cost = 0.0;
+  if (multi_start_)
+  {
+    // Start 0 continues from u_init, the others from the seed library. All
+    // starts share the deadline, so latency stays that of a single solve.
+    std::copy(u_init.begin(), u_init.end(), multi_start_seed(multi_start_, 0));
+    for (int s = 0; s < seed_library_.size(); s++)
+      std::copy(seed_library_[s].begin(), seed_library_[s].end(), multi_start_seed(multi_start_, s+1));
+
+    int best;
+    status = multi_start_plan(multi_start_, x0, xDes, Obs, n_obs, deadline, Opt.pool, &best);
+    if (best >= 0)
+    {
+      msStart_t *winner = &multi_start_->starts[best];
+      std::copy(winner->traj.x, winner->traj.x + n*N, traj->x.begin());
+      std::copy(winner->traj.u, winner->traj.u + m*(N-1), u_init.begin());
+      iterations = winner->opt.iterations;
+      cost = winner->opt.cost;
+      stats = winner->opt.stats;
+      seed = best;
+      if (best > 0)
+        ROS_INFO("Multi-start: seed %s won with cost %f.",
+                 multi_start_seeds_[best-1].c_str(), winner->opt.cost);
+    }
   }
-
-  // append zero command to stop vehicle
-  geometry_msgs::Twist twist;
-  FillTwistMsg(twist, 0.0, 0.0);
-  goal.traj.commands.push_back(twist);
-
-  return goal;
+  else
+  {
+    status = plan_trajectory(x0, &u_init[0], xDes, Obs, n_obs, T_horizon_, deadline, &Opt, &Traj);
+    iterations = Opt.iterations;
+    cost = Opt.cost;
+  }
+  // Nothing was solved, the states are not filled in and the commands are
+  // the unsolved seed
+  if (status == ILQG_FAILED)
+  {
+    ROS_ERROR("iLQG could not roll out the initial control sequence.");
+    return loco_msgs::TrajectoryPtr();
+  }
+  if (status == ILQG_DEADLINE)
+    ROS_WARN("iLQG stopped at its %.3fs deadline after %d iterations, using best trajectory so far.",
+             ilqr_max_time_, iterations);
+  if (scenario_log_)
+    LogScenario(x_start, x0, x_des, obstacles);
+  if (stats)
+    PublishSolverStats(*stats, seed);
+  if (use_cache && status == ILQG_CONVERGED)
+    primitive_cache_insert(primitive_cache_, x0, obs_key, cost, &u_init[0], &traj->x[0]);
+
+  // the last command stays zero
+  std::copy(u_init.begin(), u_init.end(), traj->u.begin());
+
+  return traj;
 }
 
 void TrajClient::PlanFromCurrentStateILQR()
 {
-  ilqr_loco::TrajExecGoal goal = GenTrajILQR(cur_state_, u_seq_saved_, x_des_, obs_pos_);
+  loco_msgs::TrajectoryPtr traj = GenTrajILQR(plan_state_, u_seq_saved_, x_des_, plan_obs_);
+  if (!traj)
+  {
+    StopAfterFailedPlan();
+    return;
+  }
+  traj->measured_state = plan_state_;
   // TODO do some quick checks on trajectory?
 
   if (mode_ == 7 || mode_==11) // turn on pid heading corrections during server execution
-  	goal.traj.execution_mode = 1;
+  	traj->execution_mode = 1;
 
-  SendTrajectory(goal);
+  SendTrajectory(traj);
+  latency_probe_ = plan_state_.header.stamp.toSec();
 }
 
 void TrajClient::PlanFromExtrapolatedILQR()
 {
-  nav_msgs::Odometry extrapolated = ExtrapolateState(cur_state_);
-  ilqr_loco::TrajExecGoal goal  = GenTrajILQR(extrapolated, u_seq_saved_, x_des_, obs_pos_);
+  // The plan is due to start executing one latency after the state was measured
+  ros::Time start = plan_state_.header.stamp + ros::Duration(latency_est_);
+  nav_msgs::Odometry predicted = PredictStartState(plan_state_, start);
+  loco_msgs::TrajectoryPtr traj = GenTrajILQR(predicted, u_seq_saved_, x_des_, plan_obs_);
+  if (!traj)
+  {
+    StopAfterFailedPlan();
+    return;
+  }
+  traj->header.stamp = start;
+  traj->measured_state = plan_state_;
   // TODO do some quick checks on trajectory?
 
   if (mode_ == 7 || mode_==11) // turn on pid heading corrections during server execution
-  	goal.traj.execution_mode = 1;
+  	traj->execution_mode = 1;
+
+  SendTrajectory(traj);
+  latency_probe_ = plan_state_.header.stamp.toSec();
+}
 
-  SendTrajectory(goal);
+// Brakes instead of sending an unsolved plan. That also ends the replanning
+// modes, and the next plan starts over from init_control_seq_.
+void TrajClient::StopAfterFailedPlan()
+{
+  SendZeroCommand(plan_state_);
+  reset_seq_ = true;
 }
 
 void TrajClient::MpcILQR()
 {
+  const int mode = mode_;
   T_ = 0;
   ROS_INFO("Starting mpc.");
-  start_time_ = ros::Time::now();
+  ros::Time start_time = ros::Time::now();
 
-  while( (DistToGoal() > goal_threshold_) && (ros::Time::now() - start_time_ < ros::Duration(mpc_timeout_)) )
+  while( ros::ok() && (mode_ == mode) && (DistToGoal(plan_state_) > goal_threshold_) &&
+         (ros::Time::now() - start_time < ros::Duration(mpc_timeout_)) )
   {
-    ROS_INFO("Receding horizon iteration #%d", T_);
+    ROS_INFO("Receding horizon iteration #%d", T_.load());
 
     // Change u_seq_saved_ using step_on_last_traj_
-    ROS_INFO("step_on_last_traj_: %d", step_on_last_traj_);
-    std::vector<double> u_seq_temp_ = u_seq_saved_;
-    std::copy(u_seq_saved_.begin() + (2*step_on_last_traj_), u_seq_saved_.end(), u_seq_temp_.begin());
-    u_seq_saved_ = u_seq_temp_;
+    int step = step_on_last_traj_;
+    ROS_INFO("step_on_last_traj_: %d", step);
+    std::copy(u_seq_saved_.begin() + (2*step), u_seq_saved_.end(), u_seq_saved_.begin());
 
     if (use_extrapolate_) {
       PlanFromExtrapolatedILQR();
@@ -137,30 +244,36 @@ void TrajClient::MpcILQR()
       PlanFromCurrentStateILQR();
     }
 
-    ros::spinOnce(); // to pick up new state estimates
+    // The loop already replans from the newest snapshot, so requests posted
+    // by obsCb in the meantime are dropped.
+    plan_request_ = -1;
+    FetchSnapshot(); // to pick up new state estimates
     T_++;
-    // ROS_INFO("DistToGoal: %f", DistToGoal());
+    // ROS_INFO("DistToGoal: %f", DistToGoal(plan_state_));
   }
-  ROS_INFO("Exiting MPC mode: DistToGoal: %f, time over timeout: %f.", DistToGoal(), (ros::Time::now() - start_time_).toSec());
-  SendZeroCommand();
+  ROS_INFO("Exiting MPC mode: DistToGoal: %f, time over timeout: %f.", DistToGoal(plan_state_), (ros::Time::now() - start_time).toSec());
+  if (mode_ == mode) // otherwise a new mode has taken over the car
+    SendZeroCommand(plan_state_);
 }
 
 void TrajClient::FixedRateReplanILQR()
 {
+  const int mode = mode_;
   T_ = 0;
   ROS_INFO("Starting mpc.");
-  start_time_ = ros::Time::now();
+  ros::Time start_time = ros::Time::now();
   ros::Rate rate(replan_rate_);
 
-  while( (DistToGoal() > goal_threshold_) && (ros::Time::now() - start_time_ < ros::Duration(mpc_timeout_)) )
+  while( ros::ok() && (mode_ == mode) && (DistToGoal(plan_state_) > goal_threshold_) &&
+         (ros::Time::now() - start_time < ros::Duration(mpc_timeout_)) )
   {
-    ROS_INFO("Receding horizon iteration #%d", T_);
+    ROS_INFO("Receding horizon iteration #%d", T_.load());
 
     // Change u_seq_saved_ using step_on_last_traj_
-    ROS_INFO("step_on_last_traj_: %d", step_on_last_traj_);
-    std::vector<double> u_seq_temp_(2*T_horizon_);
-    std::copy(u_seq_saved_.begin() + (2*step_on_last_traj_), u_seq_saved_.end(), u_seq_temp_.begin());
-    u_seq_saved_ = u_seq_temp_;
+    int step = step_on_last_traj_;
+    ROS_INFO("step_on_last_traj_: %d", step);
+    std::copy(u_seq_saved_.begin() + (2*step), u_seq_saved_.end(), u_seq_saved_.begin());
+    std::fill(u_seq_saved_.end() - (2*step), u_seq_saved_.end(), 0.0);
 
     if (use_extrapolate_){
       PlanFromExtrapolatedILQR();
@@ -169,38 +282,127 @@ void TrajClient::FixedRateReplanILQR()
       PlanFromCurrentStateILQR();
     }
 
-    ros::spinOnce(); // to pick up new state estimates
     T_++;
     rate.sleep();
+    plan_request_ = -1;
+    FetchSnapshot(); // to pick up new state estimates
+  }
+  if (mode_ == mode)
+    SendZeroCommand(plan_state_);
+}
+
+// State the car will be in at start. The car model is run from the measured
+// state over the commands executed until then, those of the last trajectory
+// sent, on the solver's time grid.
+nav_msgs::Odometry TrajClient::PredictStartState(const nav_msgs::Odometry &state, const ros::Time &start)
+{
+  loco_msgs::TrajectoryConstPtr last;
+  {
+    std::lock_guard<std::mutex> lock(last_traj_mutex_);
+    last = last_traj_;
+  }
+
+  std::vector<double> u;
+  std::vector<double> dt;
+  double t = state.header.stamp.toSec();
+  double t_end = start.toSec();
+  while (t_end - t > 1e-6)
+  {
+    double thr = 0.0, steer = 0.0;
+    if (last && last->n_u > 0 && !last->u.empty())
+    {
+      // the car keeps the last command once a trajectory has run out
+      int n = last->u.size()/last->n_u;
+      int i = floor((t - last->header.stamp.toSec())/last->timestep);
+      i = std::max(0, std::min(i, n-1));
+      thr = last->u[i*last->n_u+0];
+      steer = last->u[i*last->n_u+1];
+    }
+    u.push_back(thr);
+    u.push_back(steer);
+    dt.push_back(std::min(timestep_, t_end - t));
+    t += dt.back();
+  }
+
+  nav_msgs::Odometry predicted = state;
+  predicted.header.stamp = start;
+  if (dt.empty())
+    return predicted;
+
+  double x0[N_X] = {state.pose.pose.position.x, state.pose.pose.position.y,
+                    tf::getYaw(state.pose.pose.orientation),
+                    state.twist.twist.linear.x, state.twist.twist.linear.y,
+                    state.twist.twist.angular.z, u[0], u[1], 0, 0};
+  double x_end[N_X];
+  if (!simulate_controls(x_end, x0, &u[0], &dt[0], dt.size(), Opt.p))
+  {
+    ROS_WARN("Start state prediction diverged, planning from the measured state.");
+    return predicted;
   }
-  SendZeroCommand();
+
+  predicted.pose.pose.position.x = x_end[0];
+  predicted.pose.pose.position.y = x_end[1];
+  predicted.pose.pose.orientation = tf::createQuaternionMsgFromYaw(x_end[2]);
+  predicted.twist.twist.linear.x = x_end[3];
+  predicted.twist.twist.linear.y = x_end[4];
+  predicted.twist.twist.angular.z = x_end[5];
+
+  predicted_state_pub_.publish(predicted);
+
+  return predicted;
 }
 
-nav_msgs::Odometry TrajClient::ExtrapolateState(const nav_msgs::Odometry &state)
+// Called with the first feedback on a plan: how long after its state
+// estimate the plan actually started executing.
+void TrajClient::RecordLatency(int step)
 {
-  nav_msgs::Odometry extrapolated = state;
+  double source = latency_probe_.exchange(0.0);
+  if (source <= 0.0)
+    return;
 
-  //now a parameter: extrapolate_dt_
-  // double dt = 0.1; //[s] TODO make this parameter, or function of T_horizon_ and max_iter_
+  double sample = ros::Time::now().toSec() - step*timestep_ - source;
+  latency_est_ = latency_est_ + latency_filter_gain_*(sample - latency_est_);
+}
 
-  // extrapolated.pose.pose.position.x += (dt*extrapolated.twist.twist.linear.x);
-  // extrapolated.pose.pose.position.y += (dt*extrapolated.twist.twist.linear.y);
-    double theta = tf::getYaw(extrapolated.pose.pose.orientation);
-    double vx_world = extrapolated.twist.twist.linear.x*cos(theta) + extrapolated.twist.twist.linear.y*sin(theta);
-    double vy_world = extrapolated.twist.twist.linear.x*sin(theta) + extrapolated.twist.twist.linear.y*cos(theta);
-    extrapolated.pose.pose.position.x += (extrapolate_dt_*vx_world);
-    extrapolated.pose.pose.position.y += (extrapolate_dt_*vy_world);
+double TrajClient::DistToGoal(const nav_msgs::Odometry &state)
+{
+  return sqrt( pow((x_des_[0]- state.pose.pose.position.x), 2) +
+               pow((x_des_[1]- state.pose.pose.position.y), 2) );
+}
 
-    theta += extrapolate_dt_*extrapolated.twist.twist.angular.z;
-    extrapolated.pose.pose.orientation = tf::createQuaternionMsgFromYaw(theta);
+void TrajClient::PlannerLoop()
+{
+  while (!planner_shutdown_ && ros::ok())
+  {
+    int mode;
+    {
+      std::unique_lock<std::mutex> lock(planner_mutex_);
+      planner_cond_.wait_for(lock, std::chrono::milliseconds(100),
+                             [this]{ return planner_shutdown_ || plan_request_ >= 0; });
+      mode = plan_request_.exchange(-1);
+    }
+    if (mode < 0 || !FetchSnapshot())
+      continue;
 
-    predicted_state_pub_.publish(extrapolated);
+    if (reset_seq_.exchange(false))
+      u_seq_saved_ = init_control_seq_;
 
-  return extrapolated;
+    if (mode == 2)
+      PlanFromExtrapolatedILQR();
+    else if (mode==3 || mode==7)
+      PlanFromCurrentStateILQR();
+    else if (mode==4 || mode==5 || mode==11)
+      MpcILQR();
+    else if (mode==6)
+      FixedRateReplanILQR();
+  }
 }
 
-double TrajClient::DistToGoal()
+// Copies the newest state and obstacles into plan_state_ and plan_obs_.
+// Returns false until both have been received.
+bool TrajClient::FetchSnapshot()
 {
-  return sqrt( pow((x_des_[0]- cur_state_.pose.pose.position.x), 2) +
-               pow((x_des_[1]- cur_state_.pose.pose.position.y), 2) );
+  bool have_state = state_mailbox_.Fetch(plan_state_);
+  bool have_obs = obs_mailbox_.Fetch(plan_obs_);
+  return have_state && have_obs;
 }
@@ -35,6 +35,8 @@ void TrajClient::LoadParams()
     // Get parameters from ROS Param server
     TRYGETPARAM("timestep", timestep_)
     TRYGETPARAM("extrapolate_dt", extrapolate_dt_)
+    TRYGETPARAM("latency_filter_gain", latency_filter_gain_)
+    latency_est_ = extrapolate_dt_;
 
     TRYGETPARAM("kp_ramp", kp_)
     TRYGETPARAM("ki_ramp", ki_)
@@ -52,6 +54,7 @@ void TrajClient::LoadParams()
     TRYGETPARAM("stop_goal_threshold", goal_threshold_)
     TRYGETPARAM("use_extrapolate", use_extrapolate_)
 	  TRYGETPARAM("replan_rate", replan_rate_)
+    TRYGETPARAM("exec_in_process", exec_in_process_)
 
     TRYGETPARAM("ilqr_tolFun", ilqr_tolFun_)
     TRYGETPARAM("ilqr_tolConstraint", ilqr_tolConstraint_)
@@ -59,12 +62,26 @@ void TrajClient::LoadParams()
     TRYGETPARAM("ilqr_max_iter", ilqr_max_iter_)
     TRYGETPARAM("ilqr_regType", ilqr_regType_)
     TRYGETPARAM("ilqr_debug_level", ilqr_debug_level_)
+    TRYGETPARAM("ilqr_max_time", ilqr_max_time_)
+    TRYGETPARAM("obs_cull_dist", obs_cull_dist_)
+    TRYGETPARAM("max_obstacles", max_obstacles_)
+    TRYGETPARAM("solver_log_file", solver_log_file_)
+    TRYGETPARAM("scenario_log_file", scenario_log_file_)
+    TRYGETPARAM("multi_start_seeds", multi_start_seeds_)
+    TRYGETPARAM("multi_start_cancel_margin", multi_start_cancel_margin_)
+    TRYGETPARAM("primitive_cache_file", primitive_cache_file_)
+    TRYGETPARAM("primitive_cache_size", primitive_cache_size_)
+    TRYGETPARAM("primitive_cache_max_dist", primitive_cache_max_dist_)
+    TRYGETPARAM("primitive_cache_merge_dist", primitive_cache_merge_dist_)
+    TRYGETPARAM("primitive_cache_scale", primitive_cache_scale_)
 
     TRYGETPARAM("init_control_seq", init_control_seq_)
 	  u_seq_saved_ = init_control_seq_;
-	T_horizon_ = init_control_seq_.size();
+	T_horizon_ = init_control_seq_.size()/2; // (thr, steer) pairs
 
     LoadOpt();
+    LoadSeedLibrary();
+    LoadPrimitiveCache();
   }
   catch(...)
   {
@@ -139,8 +156,11 @@ void TrajClient::LoadOpt()
   Opt = INIT_OPTSET;
 
   SetOptParams(&Opt);
+  Opt.obs_cull_dist = obs_cull_dist_;
+  Opt.obs_capacity = max_obstacles_;
+  plan_obs_xy_.reserve(2*max_obstacles_);
 
-  Opt.p= (double **) malloc(n_params*sizeof(double *));
+  Opt.p= (double **) calloc(n_params, sizeof(double *));
 
   Opt.p[0] = assignPtrVal(&G_f_,1);
   Opt.p[1] = assignPtrVal(&G_r_,1);;
@@ -169,5 +189,94 @@ void TrajClient::LoadOpt()
   Opt.p[24] = assignPtrVal(&px_[0],3);
   // [25] xDes
 
-  char *err_msg;
+  // line search workers, the planning thread is the remaining one
+  Opt.pool= thread_pool_create(NUMBER_OF_THREADS-1);
+
+  // telemetry of every plan, published by PublishSolverStats
+  iter_stats_.resize(ilqr_max_iter_);
+  solve_stats_.max_iter = ilqr_max_iter_;
+  solve_stats_.iter = &iter_stats_[0];
+  Opt.stats = &solve_stats_;
+
+  if (!solver_log_file_.empty())
+  {
+    solver_log_ = fopen(solver_log_file_.c_str(), "wb");
+    if (solver_log_ == NULL)
+      ROS_ERROR("Could not open solver log %s.", solver_log_file_.c_str());
+  }
+
+  if (!scenario_log_file_.empty())
+  {
+    scenario_log_ = fopen(scenario_log_file_.c_str(), "a");
+    if (scenario_log_ == NULL)
+      ROS_ERROR("Could not open scenario log %s.", scenario_log_file_.c_str());
+  }
+
+  // solver buffers live as long as the client and are reused by every plan
+  if(!alloc_solver(&Opt, T_horizon_))
+    ROS_ERROR("Could not allocate iLQG solver for horizon %d.", T_horizon_);
+}
+
+// Seeds are init_control_seq files loaded under their own namespace. Each is
+// cut or padded with its last command to the planning horizon.
+void TrajClient::LoadSeedLibrary()
+{
+  std::vector<std::string> loaded;
+  seed_library_.clear();
+  for (int i = 0; i < multi_start_seeds_.size(); i++)
+  {
+    std::vector<double> seed;
+    std::string key = multi_start_seeds_[i] + "/init_control_seq";
+    TRYGETPARAM(key.c_str(), seed)
+    if (seed.size() < 2)
+    {
+      ROS_WARN("Seed %s is empty, skipping it.", multi_start_seeds_[i].c_str());
+      continue;
+    }
+
+    int n_given = seed.size()/2;
+    double thr = seed[2*n_given-2];
+    double steer = seed[2*n_given-1];
+    seed.resize(2*T_horizon_);
+    for (int k = n_given; k < T_horizon_; k++)
+    {
+      seed[2*k] = thr;
+      seed[2*k+1] = steer;
+    }
+    seed_library_.push_back(seed);
+    loaded.push_back(multi_start_seeds_[i]);
+  }
+  multi_start_seeds_.swap(loaded);
+
+  if (seed_library_.empty())
+    return;
+
+  // start 0 is always the warm start from the previous solution
+  multi_start_ = multi_start_create(&Opt, 1 + seed_library_.size(), T_horizon_,
+                                    multi_start_cancel_margin_);
+  if (multi_start_ == NULL)
+    ROS_ERROR("Could not allocate multi-start solvers, planning from a single seed.");
+  else
+    ROS_INFO("Multi-start iLQG with %d library seeds.", (int)seed_library_.size());
+}
+
+// The cache file is reused across runs as long as horizon and size match,
+// otherwise it starts empty.
+void TrajClient::LoadPrimitiveCache()
+{
+  if (primitive_cache_file_.empty())
+    return;
+  if (primitive_cache_scale_.size() != PC_KEY_DIM)
+  {
+    ROS_ERROR("primitive_cache_scale needs %d entries, primitive cache disabled.", PC_KEY_DIM);
+    return;
+  }
+
+  primitive_cache_ = primitive_cache_open(primitive_cache_file_.c_str(), T_horizon_, primitive_cache_size_,
+                                          &primitive_cache_scale_[0], primitive_cache_merge_dist_);
+  if (primitive_cache_ == NULL)
+    ROS_ERROR("Could not map primitive cache %s, primitive cache disabled.", primitive_cache_file_.c_str());
+  else
+    ROS_INFO("Primitive cache %s holds %d solutions.", primitive_cache_file_.c_str(),
+             primitive_cache_->header->count);
 }
@@ -26,7 +26,7 @@
 
 #include "traj_client.h"
 
-ilqr_loco::TrajExecGoal TrajClient::rampGenerateTrajectory(nav_msgs::Odometry prev_state,
+loco_msgs::TrajectoryPtr TrajClient::rampGenerateTrajectory(nav_msgs::Odometry prev_state,
                                                            nav_msgs::Odometry cur_state) {
 
   double dt = (cur_state.header.stamp).toSec() - (prev_state.header.stamp).toSec();
@@ -65,39 +65,32 @@ ilqr_loco::TrajExecGoal TrajClient::rampGenerateTrajectory(nav_msgs::Odometry pr
     // ROS_INFO("v = %f", v);
   }
 
-  ilqr_loco::TrajExecGoal goal;
-
-  geometry_msgs::Twist control_msg;
-  FillTwistMsg(control_msg, v, output);
-  goal.traj.commands.push_back(control_msg);
-
-  nav_msgs::Odometry state_msg;
   double expected_x = start_state_.pose.pose.position.x
                       + pre_ramp_vel_*pre_ramp_time_
                       + 0.5*accel_*start_time_.toSec()*start_time_.toSec();
   double expected_y = start_state_.pose.pose.position.y;
 
-  FillOdomMsg(state_msg, expected_x, expected_y, 0, v, 0, 0); //0s: yaw, vy, w
-  goal.traj.states.push_back(state_msg);
-
   ++T_;
   ramp_goal_flag_ = (v >= target_vel_) ? true : false;  // Ramp completion flag
-  FillGoalMsgHeader(goal);
 
-  return goal;
+  loco_msgs::TrajectoryPtr traj = NewTrajectory(1, 6);
+  SetCommand(*traj, 0, v, output);
+  SetState(*traj, 0, expected_x, expected_y, 0, v, 0, 0); //0s: yaw, vy, w
+
+  return traj;
 }
 
 
 void TrajClient::rampPlan() {
 
   if(ros::Time::now() - start_time_ < ros::Duration(timeout_)) {
-    ilqr_loco::TrajExecGoal goal = rampGenerateTrajectory(prev_state_, cur_state_);
-    SendTrajectory(goal);
+    loco_msgs::TrajectoryPtr traj = rampGenerateTrajectory(prev_state_, cur_state_);
+    SendTrajectory(traj);
   }
   else {
     // Stop car after ramp timeout
     ROS_INFO("Timeout exceeded, stopping car");
-    SendZeroCommand();
+    SendZeroCommand(cur_state_);
     mode_ = 0;
   }
 }
@@ -0,0 +1,105 @@
+//
+// MIT License
+//
+// Copyright (c) 2017 MRSD Team D - LoCo
+// The Robotics Institute, Carnegie Mellon University
+// http://mrsdprojects.ri.cmu.edu/2016teamd/
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "traj_client.h"
+
+// Binary solver log: one record per plan in native byte order and layout,
+// a SolverLogRecord followed by n_iter iterStats_t.
+struct SolverLogRecord
+{
+  double stamp;
+  int status;
+  int seed;
+  int n_iter;
+  int allocations;
+  double t_total, t_derivs, t_back_pass, t_line_search;
+};
+
+void TrajClient::PublishSolverStats(const solveStats_t &stats, int seed)
+{
+  loco_msgs::SolverStats msg;
+  msg.header.stamp = ros::Time::now();
+  msg.status = stats.status;
+  msg.seed = seed;
+  msg.allocations = stats.n_allocs;
+  msg.cost = stats.cost;
+  msg.t_total = stats.t_total;
+  msg.t_derivs = stats.t_derivs;
+  msg.t_back_pass = stats.t_back_pass;
+  msg.t_line_search = stats.t_line_search;
+
+  msg.iterations.resize(stats.n_iter);
+  for (int i = 0; i < stats.n_iter; i++)
+  {
+    const iterStats_t &it = stats.iter[i];
+    msg.iterations[i].cost = it.cost;
+    msg.iterations[i].dcost = it.dcost;
+    msg.iterations[i].lambda = it.lambda;
+    msg.iterations[i].g_norm = it.g_norm;
+    msg.iterations[i].alpha_idx = it.alpha_idx;
+    msg.iterations[i].t_derivs = it.t_derivs;
+    msg.iterations[i].t_back_pass = it.t_back_pass;
+    msg.iterations[i].t_line_search = it.t_line_search;
+  }
+  solver_stats_pub_.publish(msg);
+
+  if (solver_log_)
+  {
+    SolverLogRecord rec;
+    rec.stamp = msg.header.stamp.toSec();
+    rec.status = stats.status;
+    rec.seed = seed;
+    rec.n_iter = stats.n_iter;
+    rec.allocations = stats.n_allocs;
+    rec.t_total = stats.t_total;
+    rec.t_derivs = stats.t_derivs;
+    rec.t_back_pass = stats.t_back_pass;
+    rec.t_line_search = stats.t_line_search;
+    fwrite(&rec, sizeof(rec), 1, solver_log_);
+    fwrite(stats.iter, sizeof(iterStats_t), stats.n_iter, solver_log_);
+    fflush(solver_log_);
+  }
+}
+
+// Appends the inputs of a plan as a benchmark scenario, see ilqr_bench.cpp.
+// Replans can start from the same state estimate, so the key carries a plan
+// index after the stamp.
+void TrajClient::LogScenario(const nav_msgs::Odometry &x_start, const double *x0, const std::vector<double> &x_des,
+                             const std::vector<geometry_msgs::Point> &obstacles)
+{
+  fprintf(scenario_log_, "plan_%u_%09u_%d: {x0: [", x_start.header.stamp.sec, x_start.header.stamp.nsec,
+          scenario_count_++);
+  for (int i = 0; i < 6; i++)
+    fprintf(scenario_log_, i ? ", %.9g" : "%.9g", x0[i]);
+  fprintf(scenario_log_, "], x_des: [");
+  for (int i = 0; i < x_des.size(); i++)
+    fprintf(scenario_log_, i ? ", %.9g" : "%.9g", x_des[i]);
+  fprintf(scenario_log_, "], obstacles: [");
+  for (int i = 0; i < obstacles.size(); i++)
+    fprintf(scenario_log_, i ? ", %.9g, %.9g" : "%.9g, %.9g", obstacles[i].x, obstacles[i].y);
+  fprintf(scenario_log_, "]}\n");
+  fflush(scenario_log_);
+}
@@ -0,0 +1,387 @@
+//
+// MIT License
+//
+// Copyright (c) 2017 MRSD Team D - LoCo
+// The Robotics Institute, Carnegie Mellon University
+// http://mrsdprojects.ri.cmu.edu/2016teamd/
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "traj_executor.h"
+
+#include <chrono>
+#include <cmath>
+#include <string.h>
+#include <pthread.h>
+#include <tf/transform_datatypes.h>
+
+TrajExecutor::TrajExecutor(FeedbackCallback feedback_cb):
+  feedback_cb_(feedback_cb), cur_yaw_(0), cur_integral_(0), prev_error_(0),
+  cancel_(false), shutdown_(false)
+{
+  cmd_pub_ = nh.advertise<geometry_msgs::Twist>("cmd_vel", 1);
+  path_pub_ = nh.advertise<nav_msgs::Path>("path", 1);
+  state_sub_ = nh.subscribe("odometry/filtered", 1, &TrajExecutor::stateCb, this);
+
+  LoadParams();
+
+  thread_ = std::thread(&TrajExecutor::Run, this);
+}
+
+TrajExecutor::~TrajExecutor()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    shutdown_ = true;
+  }
+  cond_.notify_one();
+  thread_.join();
+}
+
+void TrajExecutor::LoadParams()
+{
+  ROS_INFO("Loading traj executor params.");
+  TRYGETPARAM("old_msg_discard_thres", old_msg_thres_)
+  TRYGETPARAM("kp_heading", kp_)
+  TRYGETPARAM("ki_heading", ki_)
+  TRYGETPARAM("kd_heading", kd_)
+  TRYGETPARAM("exec_rate", exec_rate_)
+  TRYGETPARAM("exec_blend_time", blend_time_)
+  TRYGETPARAM("exec_rt_priority", rt_priority_)
+}
+
+bool TrajExecutor::Submit(const loco_msgs::TrajectoryConstPtr &traj)
+{
+  if (!CheckLengths(*traj))
+    return false;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_ = traj;
+  }
+  cond_.notify_one();
+  return true;
+}
+
+// Commands are read as (throttle, steering) pairs and states for their yaw,
+// so both arrays must hold whole steps of at least that size.
+bool TrajExecutor::CheckLengths(const loco_msgs::Trajectory &traj)
+{
+  if (traj.n_u < 2 || traj.u.empty() || traj.u.size() % traj.n_u != 0)
+  {
+    ROS_WARN("TrajExecutor: Rejecting trajectory with %d commands of size %d.",
+             (int)traj.u.size(), traj.n_u);
+    return false;
+  }
+  if (!traj.x.empty() && (traj.n_x < 3 || traj.x.size() % traj.n_x != 0))
+  {
+    ROS_WARN("TrajExecutor: Rejecting trajectory with %d states of size %d.",
+             (int)traj.x.size(), traj.n_x);
+    return false;
+  }
+  if (!(traj.timestep > 0))
+  {
+    ROS_WARN("TrajExecutor: Rejecting trajectory with timestep %f.", traj.timestep);
+    return false;
+  }
+  return true;
+}
+
+void TrajExecutor::Cancel()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  pending_.reset();
+  cancel_ = true;
+}
+
+bool TrajExecutor::Executing(const loco_msgs::TrajectoryConstPtr &traj)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return pending_ == traj || current_ == traj;
+}
+
+bool TrajExecutor::Preempted()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return pending_ || cancel_ || shutdown_ || !ros::ok();
+}
+
+void TrajExecutor::Run()
+{
+  if (exec_rate_ > 0)
+  {
+    RunRealTime();
+    return;
+  }
+
+  while (true)
+  {
+    loco_msgs::TrajectoryConstPtr traj;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cond_.wait(lock, [this]{ return shutdown_ || pending_; });
+      if (shutdown_)
+        break;
+      traj.swap(pending_);
+      current_ = traj;
+      cancel_ = false;
+    }
+
+    ExecuteTrajectory(traj);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    current_.reset();
+  }
+}
+
+void TrajExecutor::ExecuteTrajectory(const loco_msgs::TrajectoryConstPtr &traj)
+{
+  // lengths were checked in Submit
+  const int n_x = traj->n_x;
+  const int n_u = traj->n_u;
+  const int n_commands = traj->u.size()/n_u;
+  const int n_states = traj->x.empty() ? 0 : traj->x.size()/n_x;
+
+  double timestep = traj->timestep;
+  double traj_start_time = (traj->header.stamp).toSec();
+
+  ros::Rate loop_rate(1.0/timestep);
+  PublishPath(*traj);
+
+  for (int i=0; i < n_commands; i++)
+  {
+    // a newer trajectory or a cancel ends this one
+    if (Preempted())
+    {
+      ROS_INFO("TrajExecutor: Preempted at %dth command.", i);
+      break;
+    }
+    // check that commands in plan are not too old
+    else if ((ros::Time::now().toSec() - (traj_start_time + (i*timestep))) > old_msg_thres_)
+    {
+      ROS_INFO("TrajExecutor: Ignoring old command.");
+      continue;
+    }
+
+    geometry_msgs::Twist twist;
+    twist.linear.x = traj->u[i*n_u+0];
+    twist.angular.z = traj->u[i*n_u+1];
+    if (traj->execution_mode == 1 && i < n_states)
+      twist = PidCorrectYaw(twist, traj->x[i*n_x+2], timestep);
+    cmd_pub_.publish(twist);
+
+    feedback_cb_(traj, i);
+
+    int steps_left = n_commands - i;
+    if (steps_left>1)
+      loop_rate.sleep();
+  }
+}
+
+void TrajExecutor::RunRealTime()
+{
+  if (rt_priority_ > 0)
+  {
+    sched_param sp;
+    sp.sched_priority = rt_priority_;
+    int err = pthread_setschedparam(pthread_self(), SCHED_FIFO, &sp);
+    if (err)
+      ROS_WARN("TrajExecutor: Could not set real-time priority %d: %s", rt_priority_, strerror(err));
+  }
+
+  typedef std::chrono::steady_clock Clock;
+  const Clock::duration period = std::chrono::duration_cast<Clock::duration>(
+      std::chrono::duration<double>(1.0/exec_rate_));
+  Clock::time_point deadline = Clock::now();
+
+  loco_msgs::TrajectoryConstPtr traj;
+  loco_msgs::TrajectoryConstPtr prev;   // blended out after a switch
+  double switch_time = 0;
+  int last_step = -1;
+
+  while (true)
+  {
+    double now = ros::Time::now().toSec();
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (shutdown_)
+        break;
+      if (cancel_)
+      {
+        current_.reset();
+        prev.reset();
+        cancel_ = false;
+      }
+      // a new trajectory takes over once it is due, or right away if idle
+      if (pending_ && (!current_ || now >= pending_->header.stamp.toSec()))
+      {
+        prev = current_;
+        switch_time = now;
+        current_.swap(pending_);
+        pending_.reset();
+        last_step = -1;
+      }
+      if (!current_)
+      {
+        cond_.wait(lock, [this]{ return shutdown_ || pending_; });
+        deadline = Clock::now();
+        continue;
+      }
+      traj = current_;
+    }
+
+    const int n_commands = (traj->n_u > 0) ? traj->u.size()/traj->n_u : 0;
+    if (n_commands == 0)
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (current_ == traj)
+        current_.reset();
+      continue;
+    }
+
+    double tau = now - traj->header.stamp.toSec();
+    geometry_msgs::Twist twist;
+    double yaw_des;
+    int step = Sample(*traj, tau, twist, yaw_des);
+
+    if (prev && now - switch_time < blend_time_)
+    {
+      geometry_msgs::Twist prev_twist;
+      double prev_yaw;
+      if (prev->n_u > 0 && !prev->u.empty())
+        Sample(*prev, now - prev->header.stamp.toSec(), prev_twist, prev_yaw);
+      double w = (now - switch_time)/blend_time_;
+      twist.linear.x = w*twist.linear.x + (1-w)*prev_twist.linear.x;
+      twist.angular.z = w*twist.angular.z + (1-w)*prev_twist.angular.z;
+    }
+    else
+    {
+      prev.reset();
+    }
+
+    if (traj->execution_mode == 1 && traj->n_x > 0 && !traj->x.empty())
+      twist = PidCorrectYaw(twist, yaw_des, 1.0/exec_rate_);
+    cmd_pub_.publish(twist);
+
+    if (step != last_step)
+    {
+      feedback_cb_(traj, step);
+      last_step = step;
+    }
+
+    // done once the last command has been held for its timestep
+    if (tau >= traj->timestep*n_commands)
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (current_ == traj)
+        current_.reset();
+    }
+
+    // Absolute deadlines, so the period does not drift with the work done
+    // in it. Ticks missed in a stall are dropped, the next command is
+    // sampled at the actual time anyway.
+    deadline += period;
+    Clock::time_point t = Clock::now();
+    while (deadline <= t)
+      deadline += period;
+    std::this_thread::sleep_until(deadline);
+  }
+}
+
+// Command and desired yaw of traj tau seconds after its start, linearly
+// interpolated between knots. Returns the index of the knot before tau.
+int TrajExecutor::Sample(const loco_msgs::Trajectory &traj, double tau, geometry_msgs::Twist &twist, double &yaw_des)
+{
+  const int n_commands = traj.u.size()/traj.n_u;
+  const int n_states = (traj.n_x > 0) ? traj.x.size()/traj.n_x : 0;
+
+  double s = (traj.timestep > 0) ? tau/traj.timestep : 0.0;
+  s = clamp(s, 0.0, n_commands-1);
+  int k = std::min(int(s), n_commands-1);
+  int k1 = std::min(k+1, n_commands-1);
+  double f = s - k;
+
+  twist.linear.x = (1-f)*traj.u[k*traj.n_u+0] + f*traj.u[k1*traj.n_u+0];
+  twist.angular.z = (1-f)*traj.u[k*traj.n_u+1] + f*traj.u[k1*traj.n_u+1];
+
+  // along the shorter way around, the plan may cross +-pi between knots
+  yaw_des = 0.0;
+  if (k1 < n_states)
+  {
+    double yaw0 = traj.x[k*traj.n_x+2];
+    double d = traj.x[k1*traj.n_x+2] - yaw0;
+    yaw_des = yaw0 + f*atan2(sin(d), cos(d));
+  }
+  else if (k < n_states)
+    yaw_des = traj.x[k*traj.n_x+2];
+
+  return k;
+}
+
+geometry_msgs::Twist TrajExecutor::PidCorrectYaw(const geometry_msgs::Twist &orig_twist, double yaw_des, double dt)
+{
+  double orig_steer = orig_twist.angular.z;
+
+  // Correct steering to compensate for yaw error
+  double yaw_error = yaw_des - cur_yaw_;
+  cur_integral_ += yaw_error*dt;
+
+  double p = kp_*yaw_error;
+  double i = clamp(ki_*cur_integral_, -0.25, 0.25);
+  double d = clamp(kd_*(yaw_error-prev_error_)/dt, -0.1, 0.1);
+  double correction =  p + i + d;
+
+  double steer = orig_steer + correction;
+  prev_error_ = yaw_error;
+
+  geometry_msgs::Twist new_twist;
+  new_twist.linear.x = orig_twist.linear.x;
+  new_twist.angular.z = steer;
+
+  ROS_DEBUG("TrajExecutor: P: %.2f | I: %.2f  | D: %.2f | out: %.2f", p, i, d, correction);
+
+  return new_twist;
+}
+
+void TrajExecutor::PublishPath(const loco_msgs::Trajectory &traj)
+{
+  // only built for visualization, skip it when nobody listens
+  if (path_pub_.getNumSubscribers() == 0 || traj.n_x <= 0)
+    return;
+
+  nav_msgs::Path path_msg;
+  path_msg.header.stamp = traj.header.stamp;
+  path_msg.header.frame_id = "map";
+  path_msg.poses.resize(traj.x.size()/traj.n_x);
+
+  for (int i=0; i < path_msg.poses.size(); i++)
+  {
+    const double *x = &traj.x[i*traj.n_x];
+    path_msg.poses[i].pose.position.x = x[0];
+    path_msg.poses[i].pose.position.y = x[1];
+    path_msg.poses[i].pose.orientation = tf::createQuaternionMsgFromYaw(x[2]);
+  }
+  path_pub_.publish(path_msg);
+}
+
+void TrajExecutor::stateCb(const nav_msgs::Odometry &msg)
+{
+  cur_yaw_ = tf::getYaw(msg.pose.pose.orientation);
+}
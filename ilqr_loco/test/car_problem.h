@@ -0,0 +1,147 @@
+//
+// MIT License
+//
+// Copyright (c) 2017 MRSD Team D - LoCo
+// The Robotics Institute, Carnegie Mellon University
+// http://mrsdprojects.ri.cmu.edu/2016teamd/
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+// The car and cost parameters of traj_client.yaml as a solver problem for the
+// tests, by default passing one obstacle beside the straight line to xDes.
+
+#ifndef CAR_PROBLEM_H
+#define CAR_PROBLEM_H
+
+#include <math.h>
+#include <string.h>
+#include <vector>
+
+extern "C"{
+  #include "iLQG.h"
+  #include "iLQG_plan.h"
+}
+
+class CarProblem
+{
+public:
+  static const int kMaxObstacles = 4;
+
+  explicit CarProblem(int T) : T_(T), x0_(N_X, 0.0), u0_(N_U*T), x_(N_X*(T+1)), u_(N_U*T), obs_(2)
+  {
+    const double g = 9.81;
+    m_ = 2.35; b_ = 0.14328; a_ = 0.257 - b_;
+    G_f_ = m_*g*b_/0.257; G_r_ = m_*g*a_/0.257;
+    Iz_ = 0.045; c_x_ = 116; c_a_ = 197; mu_ = 1.31; mu_s_ = 0.55;
+    cdrift_ = -0.001; d_thres_ = 0.5; h_ = 0.05; k_pos_ = 1.0; k_vel_ = 0.0;
+
+    const double cu[] = {0.01, 0.01}, cdu[] = {1.0, 0.4};
+    const double cf[] = {100, 100, 5, 10, 0.1, 0.1}, pf[] = {0.01, 0.01, 0.1, 0.1, 0.1, 0.1};
+    const double cx[] = {0.05, 0.5, 0.04}, cdx[] = {0.001, 0.005, 0.002}, px[] = {0.01, 0.01, 0.1};
+    const double limThr[] = {0, 3}, limSteer[] = {-0.77, 0.77};
+    memcpy(cu_, cu, sizeof(cu_)); memcpy(cdu_, cdu, sizeof(cdu_));
+    memcpy(cf_, cf, sizeof(cf_)); memcpy(pf_, pf, sizeof(pf_));
+    memcpy(cx_, cx, sizeof(cx_)); memcpy(cdx_, cdx, sizeof(cdx_)); memcpy(px_, px, sizeof(px_));
+    memcpy(limThr_, limThr, sizeof(limThr_)); memcpy(limSteer_, limSteer, sizeof(limSteer_));
+
+    tOptSet init = INIT_OPTSET;
+    opt = init;
+    opt.tolFun = 1e-7;
+    opt.tolConstraint = 1e-7;
+    opt.tolGrad = 1e-5;
+    opt.max_iter = 30;
+    opt.regType = 1;
+    opt.p = p_;
+    memset(p_, 0, sizeof(p_));
+    p_[0] = &G_f_; p_[1] = &G_r_; p_[2] = &Iz_; p_[4] = &a_; p_[5] = &b_;
+    p_[6] = &c_a_; p_[7] = &c_x_; p_[8] = &cdrift_; p_[9] = cdu_; p_[10] = cdx_;
+    p_[11] = cf_; p_[12] = cu_; p_[13] = cx_; p_[14] = &d_thres_; p_[15] = &h_;
+    p_[16] = &k_pos_; p_[17] = &k_vel_; p_[18] = limSteer_; p_[19] = limThr_;
+    p_[20] = &m_; p_[21] = &mu_; p_[22] = &mu_s_; p_[23] = pf_; p_[24] = px_;
+    opt.pool = thread_pool_create(NUMBER_OF_THREADS-1);
+    opt.obs_capacity = kMaxObstacles;
+
+    x0_[3] = 2.5;
+    x0_[4] = 0.01;
+    xDes_[0] = 5;
+    for (int i = 1; i < 6; i++)
+      xDes_[i] = 0;
+    obs_[0] = 2.5;
+    obs_[1] = 0.1;
+
+    // steering back and forth at a constant throttle
+    for (int k = 0; k < T; k++)
+    {
+      u0_[MAT_IDX(0, k, N_U)] = 2.0;
+      u0_[MAT_IDX(1, k, N_U)] = 0.3*sin(0.2*k);
+    }
+    x0_[6] = u0_[0];
+    x0_[7] = u0_[1];
+  }
+
+  ~CarProblem()
+  {
+    free_solver(&opt);
+    thread_pool_destroy(opt.pool);
+  }
+
+  // x, y pairs, at most kMaxObstacles
+  void setObstacles(const std::vector<double> &xy)
+  {
+    obs_ = xy;
+  }
+
+  // What plan_trajectory does before iLQG: the nominal is the rollout of u0
+  bool setup()
+  {
+    standard_parameters(&opt);
+    opt.x0 = &x0_[0];
+    if (!alloc_solver(&opt, T_))
+      return false;
+    init_params(&opt, xDes_, obs_.empty() ? NULL : &obs_[0], obs_.size()/2);
+    if (!init_opt(&opt))
+      return false;
+    for (int k = 0; k < T_; k++)
+      for (int i = 0; i < N_U; i++)
+        opt.nominal->t[k].u[i] = u0_[MAT_IDX(i, k, N_U)];
+    if (!forward_pass(opt.candidates[0], &opt, 0.0, &opt.cost, 0))
+      return false;
+    makeCandidateNominal(&opt, 0);
+    return true;
+  }
+
+  int plan()
+  {
+    struct trajectory traj = {&x_[0], &u_[0]};
+    return plan_trajectory(&x0_[0], &u0_[0], xDes_, obs_.empty() ? NULL : &obs_[0], obs_.size()/2, T_, 0, &opt, &traj);
+  }
+
+  tOptSet opt;
+
+private:
+  int T_;
+  std::vector<double> x0_, u0_, x_, u_, obs_;
+  double xDes_[6];
+  double *p_[26];
+  double G_f_, G_r_, Iz_, a_, b_, c_a_, c_x_, cdrift_, d_thres_, h_, k_pos_, k_vel_, m_, mu_, mu_s_;
+  double cu_[2], cdu_[2], cf_[6], pf_[6], cx_[3], cdx_[3], px_[3], limThr_[2], limSteer_[2];
+};
+
+#endif
@@ -0,0 +1,48 @@
+//
+// MIT License
+//
+// Copyright (c) 2017 MRSD Team D - LoCo
+// The Robotics Institute, Carnegie Mellon University
+// http://mrsdprojects.ri.cmu.edu/2016teamd/
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+// Scenarios solved by test_precision in double and, through the
+// precision_solve_float helper, in single precision: the car passing one
+// obstacle at n positions on a grid ahead of it.
+
+#ifndef PRECISION_SCENARIOS_H
+#define PRECISION_SCENARIOS_H
+
+#include "car_problem.h"
+
+// cost of scenario s of n after max_iter iterations
+inline double scenarioCost(int s, int n, int max_iter)
+{
+  CarProblem car(60);
+  car.opt.max_iter = max_iter;
+  double xy[2] = {2.0 + 0.1*(s % 8), -0.3 + 0.6*(s/8)/((n + 7)/8)};
+  car.setObstacles(std::vector<double>(xy, xy + 2));
+  car.plan();
+  return car.opt.cost;
+}
+
+#endif
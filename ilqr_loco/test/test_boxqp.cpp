@@ -0,0 +1,192 @@
+//
+// MIT License
+//
+// Copyright (c) 2017 MRSD Team D - LoCo
+// The Robotics Institute, Carnegie Mellon University
+// http://mrsdprojects.ri.cmu.edu/2016teamd/
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+// The closed form boxQP_2 against the iterative boxQP it replaces in the back
+// pass, on random positive definite problems.
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdlib.h>
+
+extern "C"{
+  #include "iLQG.h"
+  #include "boxQP.h"
+  #include "matMult.h"
+}
+
+namespace
+{
+
+double uniform(double lo, double hi)
+{
+  return lo + (hi - lo)*rand()/(double)RAND_MAX;
+}
+
+// H= R(phi)' diag(e0, e1) R(phi), upper triangle
+void randomPD(double H[3], double min_eig, double max_eig)
+{
+  double phi = uniform(0, M_PI);
+  double c = cos(phi), s = sin(phi);
+  double e0 = exp(uniform(log(min_eig), log(max_eig)));
+  double e1 = exp(uniform(log(min_eig), log(max_eig)));
+
+  H[UTRI_MAT_IDX(0, 0)] = c*c*e0 + s*s*e1;
+  H[UTRI_MAT_IDX(0, 1)] = c*s*(e0 - e1);
+  H[UTRI_MAT_IDX(1, 1)] = s*s*e0 + c*c*e1;
+}
+
+double objective(const double H[3], const double g[2], const double x[2])
+{
+  return x[0]*(g[0] + 0.5*H[UTRI_MAT_IDX(0, 0)]*x[0] + H[UTRI_MAT_IDX(0, 1)]*x[1]) +
+         x[1]*(g[1] + 0.5*H[UTRI_MAT_IDX(1, 1)]*x[1]);
+}
+
+struct QP
+{
+  double H[3], g[2], lower[2], upper[2], warm[2];
+
+  // Bounds like those of the back pass, the control limits shifted by the
+  // nominal control, so the box does not always contain 0. The iterative
+  // solver warm starts from a point that may lie outside the box.
+  void randomize(double min_eig, double max_eig)
+  {
+    randomPD(H, min_eig, max_eig);
+    for (int i = 0; i < 2; i++)
+    {
+      g[i] = uniform(-1, 1);
+      lower[i] = uniform(-2, 0.5);
+      upper[i] = lower[i] + uniform(0.1, 2);
+      warm[i] = uniform(-2, 2);
+    }
+  }
+};
+
+struct Solution
+{
+  double x[2], invHfree[3];
+  int is_clamped[2], n_free, res;
+};
+
+Solution solveIterative(const QP &qp)
+{
+  Solution s;
+  double H[3] = {qp.H[0], qp.H[1], qp.H[2]};
+  double Hfree[3], L[3], grad[2], grad_clamped[2], search[2];
+
+  s.x[0] = qp.warm[0];
+  s.x[1] = qp.warm[1];
+  s.res = boxQP(H, qp.g, qp.lower, qp.upper, s.x, Hfree, L, grad, grad_clamped, search,
+                s.is_clamped, &s.n_free, s.invHfree, 2);
+  return s;
+}
+
+Solution solveClosedForm(const QP &qp)
+{
+  Solution s;
+  s.res = boxQP_2(qp.H, qp.g, qp.lower, qp.upper, s.x, s.is_clamped, &s.n_free, s.invHfree);
+  return s;
+}
+
+} // namespace
+
+// Same minimum, same active set and the same inverse of the free block,
+// which together make the feedback gains of the back pass.
+TEST(boxQP_2, matchesBoxQP)
+{
+  srand(1);
+  QP qp;
+  int n_clamped = 0;
+  for (int trial = 0; trial < 20000; trial++)
+  {
+    qp.randomize(1e-1, 1e1);
+    Solution it = solveIterative(qp);
+    Solution cf = solveClosedForm(qp);
+    ASSERT_GE(it.res, 1) << "trial " << trial;
+    ASSERT_NE(cf.res, 0) << "trial " << trial;
+
+    for (int i = 0; i < 2; i++)
+    {
+      EXPECT_NEAR(it.x[i], cf.x[i], 1e-6) << "trial " << trial;
+      EXPECT_EQ(it.is_clamped[i], cf.is_clamped[i]) << "trial " << trial;
+    }
+    ASSERT_EQ(it.n_free, cf.n_free) << "trial " << trial;
+    for (int i = 0; i < (it.n_free*(it.n_free+1))/2; i++)
+      EXPECT_NEAR(it.invHfree[i], cf.invHfree[i], 1e-9*fabs(it.invHfree[i]) + 1e-12) << "trial " << trial;
+
+    if (it.n_free < 2)
+      n_clamped++;
+  }
+  // both the interior and the clamped cases are covered
+  EXPECT_GT(n_clamped, 1000);
+  EXPECT_LT(n_clamped, 19000);
+}
+
+// On badly conditioned problems boxQP may stop early in a narrow valley,
+// the closed form is never worse.
+TEST(boxQP_2, neverWorseThanBoxQP)
+{
+  srand(2);
+  QP qp;
+  for (int trial = 0; trial < 20000; trial++)
+  {
+    qp.randomize(1e-4, 1e2);
+    Solution it = solveIterative(qp);
+    Solution cf = solveClosedForm(qp);
+    ASSERT_NE(cf.res, 0) << "trial " << trial;
+    if (it.res < 1)
+      continue;
+
+    double v_it = objective(qp.H, qp.g, it.x);
+    double v_cf = objective(qp.H, qp.g, cf.x);
+    EXPECT_LE(v_cf, v_it + 1e-9*fabs(v_it) + 1e-12) << "trial " << trial;
+    for (int i = 0; i < 2; i++)
+    {
+      EXPECT_GE(cf.x[i], qp.lower[i]);
+      EXPECT_LE(cf.x[i], qp.upper[i]);
+    }
+  }
+}
+
+// Left to boxQP, which the back pass falls back to
+TEST(boxQP_2, rejectsIndefinite)
+{
+  QP qp;
+  qp.randomize(1, 2);
+  qp.H[UTRI_MAT_IDX(0, 1)] = 3;
+  Solution cf = solveClosedForm(qp);
+  EXPECT_EQ(0, cf.res);
+
+  qp.H[UTRI_MAT_IDX(0, 0)] = -1;
+  qp.H[UTRI_MAT_IDX(0, 1)] = 0;
+  cf = solveClosedForm(qp);
+  EXPECT_EQ(0, cf.res);
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
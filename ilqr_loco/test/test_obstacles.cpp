@@ -0,0 +1,267 @@
+//
+// MIT License
+//
+// Copyright (c) 2017 MRSD Team D - LoCo
+// The Robotics Institute, Carnegie Mellon University
+// http://mrsdprojects.ri.cmu.edu/2016teamd/
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+// The hand written obstacle terms of the running cost, obstacle_cost and
+// obstacle_derivs, against the expression the problem generator wrote for a
+// single obstacle and against finite differences of themselves.
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdlib.h>
+
+#include "car_problem.h"
+
+namespace
+{
+
+// Derivatives are stored as deriv_t, see ILQG_FLOAT. A float cx of the
+// whole running cost does not resolve the change of its obstacle part over
+// a finite difference step, so cxx is only checked in double.
+#if ILQG_FLOAT
+const double kDerivTol = 1e-4;
+#else
+const double kDerivTol = 1e-6;
+#endif
+
+double uniform(double lo, double hi)
+{
+  return lo + (hi - lo)*rand()/(double)RAND_MAX;
+}
+
+// The obstacle terms of ddpL as generated for p[3] holding one obstacle
+double generatedObstacleCost(const double *x, double **p)
+{
+  return p[16][0]*((sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))>p[14][0])? 0.0: pow(1/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))-1/p[14][0],2.0))+
+         p[17][0]*((x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4]<0.0)? 0.0: (x[3]*(x[0]-p[3][0])+(x[1]-p[3][1])*x[4])/sqrt(1.e-6+pow(x[0]-p[3][0],2.0)+pow(x[1]-p[3][1],2.0))/sqrt(1.e-6+pow(x[3],2.0)+pow(x[4],2.0)));
+}
+
+// Nominal states with the car within d_thres of obstacle k % n_obs, away
+// from the kinks of the cost: the edge of d_thres and the sign change of the
+// velocity towards the obstacle.
+void nearObstacles(tOptSet *o, double min_dist, double max_dist)
+{
+  const double *obs = o->p[3];
+  for (int k = 0; k < o->n_hor; k++)
+  {
+    double *x = o->nominal->t[k].x;
+    int j = k % o->n_obs;
+    double d, phi, s;
+    do
+    {
+      d = uniform(min_dist, max_dist);
+      phi = uniform(-M_PI, M_PI);
+      x[3] = uniform(0.5, 3);
+      x[4] = uniform(-0.5, 0.5);
+      s = (x[3]*cos(phi) + x[4]*sin(phi))/sqrt(x[3]*x[3] + x[4]*x[4]);
+    } while (fabs(s) < 0.1);
+    x[0] = obs[2*j] + d*cos(phi);
+    x[1] = obs[2*j+1] + d*sin(phi);
+    x[2] = uniform(-1, 1);
+    x[5] = uniform(-1, 1);
+    for (int i = 6; i < N_X; i++)
+      x[i] = uniform(-0.5, 0.5);
+  }
+}
+
+// Running cost of every nominal step
+std::vector<double> stepCosts(tOptSet *o)
+{
+  traj_t *c = o->candidates[0];
+  double csum;
+  memcpy(c->t, o->nominal->t, o->n_hor*sizeof(trajEl_t));
+  c->f = o->nominal->f;
+  EXPECT_TRUE(forward_pass(c, o, 0.0, &csum, 1));
+
+  std::vector<double> cost(o->n_hor);
+  for (int k = 0; k < o->n_hor; k++)
+    cost[k] = c->t[k].c;
+  return cost;
+}
+
+struct Derivs
+{
+  std::vector<double> cx, cxx;
+};
+
+// cx and cxx of the running cost along the nominal
+Derivs stepDerivs(tOptSet *o)
+{
+  Derivs d;
+  EXPECT_TRUE(calc_derivs(o));
+  wait_derivs(o);
+  for (int k = 0; k < o->n_hor; k++)
+  {
+    d.cx.insert(d.cx.end(), o->derivs[k].cx, o->derivs[k].cx + N_X);
+    d.cxx.insert(d.cxx.end(), o->derivs[k].cxx, o->derivs[k].cxx + sizeofQxx);
+  }
+  return d;
+}
+
+// the parts of cost and derivatives that the obstacles add
+std::vector<double> obstacleCosts(tOptSet *o)
+{
+  int n_obs = o->n_obs;
+  std::vector<double> c = stepCosts(o);
+  o->n_obs = 0;
+  std::vector<double> c0 = stepCosts(o);
+  o->n_obs = n_obs;
+  for (int k = 0; k < o->n_hor; k++)
+    c[k] -= c0[k];
+  return c;
+}
+
+Derivs obstacleDerivs(tOptSet *o)
+{
+  int n_obs = o->n_obs;
+  Derivs d = stepDerivs(o);
+  o->n_obs = 0;
+  Derivs d0 = stepDerivs(o);
+  o->n_obs = n_obs;
+  for (int i = 0; i < d.cx.size(); i++)
+    d.cx[i] -= d0.cx[i];
+  for (int i = 0; i < d.cxx.size(); i++)
+    d.cxx[i] -= d0.cxx[i];
+  return d;
+}
+
+void shiftNominal(tOptSet *o, int i, double h)
+{
+  for (int k = 0; k < o->n_hor; k++)
+    o->nominal->t[k].x[i] += h;
+}
+
+// state components the obstacle terms depend on: position and velocity
+const int kObsStates[] = {0, 1, 3, 4};
+
+class ObstacleCost : public ::testing::Test
+{
+protected:
+  ObstacleCost() : car(40) {}
+
+  void SetUp()
+  {
+    double xy[] = {2.5, 0.1, 1.0, -1.2, 4.0, 1.5};
+    car.setObstacles(std::vector<double>(xy, xy + 6));
+    ASSERT_TRUE(car.setup());
+    // the velocity term is off in traj_client.yaml
+    car.opt.p[17][0] = 0.5;
+    srand(1);
+  }
+
+  CarProblem car;
+};
+
+} // namespace
+
+// With nothing culled the sum over the obstacles is the generated cost of
+// each one on its own
+TEST_F(ObstacleCost, matchesGeneratedCost)
+{
+  tOptSet *o = &car.opt;
+  o->obs_cull_dist = 100;
+  nearObstacles(o, 0.01, 3.0);
+  std::vector<double> cost = obstacleCosts(o);
+
+  double *obs = o->p[3];
+  double saved[2*CarProblem::kMaxObstacles];
+  memcpy(saved, obs, 2*o->n_obs*sizeof(double));
+  for (int k = 0; k < o->n_hor; k++)
+  {
+    const double *x = o->nominal->t[k].x;
+    double ref = 0;
+    for (int j = 0; j < o->n_obs; j++)
+    {
+      obs[0] = saved[2*j];
+      obs[1] = saved[2*j+1];
+      ref += generatedObstacleCost(x, o->p);
+    }
+    memcpy(obs, saved, 2*o->n_obs*sizeof(double));
+    EXPECT_NEAR(ref, cost[k], 1e-12*(1 + fabs(ref))) << "step " << k;
+  }
+}
+
+// Obstacles beyond max(d_thres, obs_cull_dist) cost nothing, not even the
+// velocity term
+TEST_F(ObstacleCost, culled)
+{
+  tOptSet *o = &car.opt;
+  o->obs_cull_dist = 0.8;
+  nearObstacles(o, 0.81, 1.2);
+  std::vector<double> cost = obstacleCosts(o);
+  Derivs d = obstacleDerivs(o);
+
+  for (int k = 0; k < o->n_hor; k++)
+    EXPECT_EQ(0, cost[k]) << "step " << k;
+  for (int i = 0; i < d.cx.size(); i++)
+    EXPECT_EQ(0, d.cx[i]);
+  for (int i = 0; i < d.cxx.size(); i++)
+    EXPECT_EQ(0, d.cxx[i]);
+}
+
+// cx against central differences of the cost, cxx against those of cx
+TEST_F(ObstacleCost, derivativesMatchFiniteDifferences)
+{
+  tOptSet *o = &car.opt;
+  const double h = 1e-6;
+  int N = o->n_hor;
+  nearObstacles(o, 0.05, 0.45);
+  Derivs d = obstacleDerivs(o);
+
+  for (int n = 0; n < 4; n++)
+  {
+    int i = kObsStates[n];
+    shiftNominal(o, i, h);
+    std::vector<double> c_up = obstacleCosts(o);
+    Derivs d_up = obstacleDerivs(o);
+    shiftNominal(o, i, -2*h);
+    std::vector<double> c_down = obstacleCosts(o);
+    Derivs d_down = obstacleDerivs(o);
+    shiftNominal(o, i, h);
+
+    for (int k = 0; k < N; k++)
+    {
+      double fd = (c_up[k] - c_down[k])/(2*h);
+      double cx = d.cx[k*N_X + i];
+      EXPECT_NEAR(fd, cx, kDerivTol*(1 + fabs(fd))) << "cx[" << i << "] at step " << k;
+
+      for (int m = 0; m < 4 && !ILQG_FLOAT; m++)
+      {
+        int j = kObsStates[m];
+        int idx = (j < i) ? UTRI_MAT_IDX(j, i) : UTRI_MAT_IDX(i, j);
+        double fd2 = (d_up.cx[k*N_X + j] - d_down.cx[k*N_X + j])/(2*h);
+        double cxx = d.cxx[k*sizeofQxx + idx];
+        EXPECT_NEAR(fd2, cxx, 10*kDerivTol*(1 + fabs(fd2))) << "cxx[" << i << ", " << j << "] at step " << k;
+      }
+    }
+  }
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,230 @@
+//
+// MIT License
+//
+// Copyright (c) 2017 MRSD Team D - LoCo
+// The Robotics Institute, Carnegie Mellon University
+// http://mrsdprojects.ri.cmu.edu/2016teamd/
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+// forward_pass_batch, which rolls out line search candidates side by side in
+// vector lanes, against the scalar forward_pass it stands in for, and the
+// candidate line_search picks from them.
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdlib.h>
+
+#include "car_problem.h"
+
+extern "C"{
+  #include "line_search.h"
+}
+
+namespace
+{
+
+// The lanes integrate in roll_t, see ILQG_FLOAT. The rounding of a float
+// step grows along the rollout, by some 1e5 over 50 steps of the seed, so
+// float is held to a shorter horizon.
+#if ILQG_FLOAT
+const int kSteps = 20;
+const double kTol = 1e-3;
+#else
+const int kSteps = 50;
+const double kTol = 1e-9;
+#endif
+
+double uniform(double lo, double hi)
+{
+  return lo + (hi - lo)*rand()/(double)RAND_MAX;
+}
+
+// Feedforward and feedback terms like a back pass would leave them
+void randomGains(tOptSet *o)
+{
+  for (int k = 0; k < o->n_hor; k++)
+  {
+    trajEl_t *t = o->nominal->t + k;
+    for (int j = 0; j < N_U; j++)
+      t->l[j] = uniform(-0.5, 0.5);
+    for (int i = 0; i < N_U*N_X; i++)
+      t->L[i] = uniform(-0.2, 0.2);
+  }
+}
+
+void expectSameRollout(const traj_t *lane, const traj_t *ref, int N, double cost, double cost_ref, int l)
+{
+  for (int k = 0; k < N; k++)
+  {
+    for (int i = 0; i < N_X; i++)
+      ASSERT_NEAR(ref->t[k].x[i], lane->t[k].x[i], kTol*(1 + fabs(ref->t[k].x[i])))
+          << "lane " << l << " x[" << i << "] at step " << k;
+    for (int j = 0; j < N_U; j++)
+      ASSERT_NEAR(ref->t[k].u[j], lane->t[k].u[j], kTol*(1 + fabs(ref->t[k].u[j])))
+          << "lane " << l << " u[" << j << "] at step " << k;
+  }
+  for (int i = 0; i < N_X; i++)
+    ASSERT_NEAR(ref->f.x[i], lane->f.x[i], kTol*(1 + fabs(ref->f.x[i]))) << "lane " << l << " final x[" << i << "]";
+  EXPECT_NEAR(cost_ref, cost, kTol*(1 + fabs(cost_ref))) << "lane " << l;
+}
+
+// Rolls out n lanes with alpha and compares each with forward_pass,
+// which writes the candidate after the lanes
+void checkBatch(tOptSet *o, const double *alpha, int n)
+{
+  double csum[ROLLOUT_LANES], cost_ref;
+  int success[ROLLOUT_LANES];
+  traj_t *ref = o->candidates[ROLLOUT_LANES];
+
+  forward_pass_batch(o->candidates, o, alpha, n, csum, success);
+  for (int l = 0; l < n; l++)
+  {
+    int ok = forward_pass(ref, o, alpha[l], &cost_ref, 0);
+    ASSERT_EQ(ok, success[l]) << "lane " << l;
+    if (ok)
+      expectSameRollout(o->candidates[l], ref, o->n_hor, csum[l], cost_ref, l);
+  }
+}
+
+// The candidate line_search should pick, from scalar rollouts: the lowest
+// cost accepted alpha of the first batch of N_CANDIDATES with any accepted.
+// Returns its cost, or NAN if none is accepted, and in first_accepted that
+// of the accepted alpha a sequential search would have stopped at.
+double bestAccepted(tOptSet *o, double *first_accepted)
+{
+  traj_t *ref = o->candidates[0];
+  *first_accepted = NAN;
+  for (int first = 0; first < o->n_alpha; first += N_CANDIDATES)
+  {
+    double best = NAN;
+    for (int j = first; j < o->n_alpha && j < first + N_CANDIDATES; j++)
+    {
+      double cost, alpha = o->alpha[j];
+      double e = -alpha*(o->dV[0] + alpha*o->dV[1]);
+      if (!forward_pass(ref, o, alpha, &cost, 0) || e <= 0)
+        continue;
+      if ((o->cost - cost)/e <= o->zMin)
+        continue;
+      if (isnan(*first_accepted))
+        *first_accepted = cost;
+      if (!(cost >= best))
+        best = cost;
+    }
+    if (!isnan(best))
+      return best;
+  }
+  return NAN;
+}
+
+} // namespace
+
+TEST(forward_pass_batch, matchesForwardPass)
+{
+  CarProblem car(kSteps);
+  ASSERT_TRUE(car.setup());
+  srand(1);
+
+  // full step down to none, which replays the nominal controls
+  double alpha[ROLLOUT_LANES];
+  for (int trial = 0; trial < 20; trial++)
+  {
+    randomGains(&car.opt);
+    for (int l = 0; l < ROLLOUT_LANES; l++)
+      alpha[l] = (l == ROLLOUT_LANES-1)? 0.0: pow(0.3, l + uniform(0, 1));
+    checkBatch(&car.opt, alpha, ROLLOUT_LANES);
+  }
+}
+
+// the lanes beyond n compute on zeros and must not disturb the others
+TEST(forward_pass_batch, partialBatch)
+{
+  CarProblem car(kSteps);
+  ASSERT_TRUE(car.setup());
+  srand(2);
+  randomGains(&car.opt);
+
+  double alpha[ROLLOUT_LANES];
+  for (int n = 1; n < ROLLOUT_LANES; n++)
+  {
+    for (int l = 0; l < n; l++)
+      alpha[l] = uniform(0.01, 1);
+    checkBatch(&car.opt, alpha, n);
+  }
+}
+
+// The states after a solve, where the car brakes and steers around the
+// obstacle, cover more of the tire model than the rollouts of the seed
+TEST(forward_pass_batch, matchesForwardPassAfterSolve)
+{
+  CarProblem car(kSteps);
+  ASSERT_GE(car.plan(), ILQG_NOT_CONVERGED);
+  srand(3);
+
+  double alpha[ROLLOUT_LANES];
+  for (int trial = 0; trial < 20; trial++)
+  {
+    randomGains(&car.opt);
+    for (int l = 0; l < ROLLOUT_LANES; l++)
+      alpha[l] = uniform(0, 1);
+    checkBatch(&car.opt, alpha, ROLLOUT_LANES);
+  }
+}
+
+TEST(line_search, picksBestAcceptedCandidate)
+{
+  CarProblem car(kSteps);
+  ASSERT_TRUE(car.setup());
+  srand(4);
+  car.opt.zMin = 1;
+
+  int n_accepted = 0, n_not_first = 0;
+  for (int trial = 0; trial < 40; trial++)
+  {
+    randomGains(&car.opt);
+    // a predicted reduction the random steps only sometimes live up to
+    car.opt.dV[0] = -car.opt.cost*exp(uniform(log(1.0), log(30.0)));
+    car.opt.dV[1] = 0;
+    double first_accepted;
+    double expected = bestAccepted(&car.opt, &first_accepted);
+
+    int success = line_search(&car.opt, 0);
+    ASSERT_EQ(!isnan(expected), success) << "trial " << trial;
+    if (success)
+    {
+      EXPECT_NEAR(expected, car.opt.new_cost, kTol*(1 + fabs(expected))) << "trial " << trial;
+      n_accepted++;
+      if (first_accepted > expected + kTol*(1 + fabs(expected)))
+        n_not_first++;
+    }
+  }
+  // both outcomes are covered, and the best accepted candidate is not
+  // always the first
+  EXPECT_GT(n_accepted, 0);
+  EXPECT_LT(n_accepted, 40);
+  EXPECT_GT(n_not_first, 0);
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
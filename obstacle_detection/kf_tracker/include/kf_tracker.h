@@ -31,6 +31,9 @@
 #include <iterator>
 #include "kf_tracker/featureDetection.h"
 #include "kf_tracker/CKalmanFilter.h"
+#include "kf_tracker/multiTracker.h"
+#include "kf_tracker/clusterStats.h"
+#include "kf_tracker/laserPoseCache.h"
 #include <opencv2/core/core.hpp>
 #include <opencv2/highgui/highgui.hpp>
 #include <opencv2/imgproc/imgproc.hpp>
@@ -41,6 +44,7 @@
 #include <pcl/point_types.h>
 #include "pcl_ros/point_cloud.h"
 #include <geometry_msgs/Point.h>
+#include <geometry_msgs/PoseArray.h>
 #include <std_msgs/Float32MultiArray.h>
 #include <std_msgs/Int32MultiArray.h>
 
@@ -63,6 +67,7 @@
 #include <visualization_msgs/Marker.h>
 #include <limits>
 #include <utility>
+#include <sstream>
 #include <pcl/registration/correspondence_estimation.h>
 
 //Constants for KF
@@ -87,19 +92,3 @@ double euclidean_distance(geometry_msgs::Point& p1, geometry_msgs::Point& p2)
 {
   return sqrt((p1.x - p2.x) * (p1.x - p2.x) + (p1.y - p2.y) * (p1.y - p2.y) + (p1.z - p2.z) * (p1.z - p2.z));
 }
-
-std::pair<int,int> findIndexOfMin(std::vector<std::vector<float> > distMat)
-{
-    std::pair<int,int>minIndex;
-    float minEl=std::numeric_limits<float>::max();
-    for (int i=0; i<distMat.size();i++)
-        for(int j=0;j<distMat.at(0).size();j++)
-        {
-            if( distMat[i][j]<minEl)
-            {
-                minEl=distMat[i][j];
-                minIndex=std::make_pair(i,j);
-            }
-        }
-    return minIndex;
-}
@@ -0,0 +1,193 @@
+//
+// MIT License
+//
+// Copyright (c) 2017 MRSD Team D - LoCo
+// The Robotics Institute, Carnegie Mellon University
+// http://mrsdprojects.ri.cmu.edu/2016teamd/
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef KF_TRACKER_BATCH_KALMAN_H
+#define KF_TRACKER_BATCH_KALMAN_H
+
+#include <vector>
+
+// Constant-velocity Kalman filters for many planar tracks at once, stored as
+// structure of arrays so predict and correct are one loop over all tracks.
+//
+// The model is the one kf_tracker has always used, with the frame as time
+// step: x' = x + vx, vx' = velocity_decay*vx, likewise for y, Q = sigma_p*I,
+// R = sigma_q*I and only the position measured. With diagonal Q, R and
+// initial covariance the x and y axes never couple, so the 4x4 covariance is
+// two symmetric 2x2 blocks and each axis keeps three entries, (pos, pos),
+// (pos, vel) and (vel, vel). The innovation covariance is then diagonal too.
+
+class BatchKalman
+{
+public:
+  BatchKalman(): velocity_decay(0.01f), sigma_p(0.01f), sigma_q(0.1f), sigma_init(1.0f)
+  {
+  }
+
+  int size() const { return x.size(); }
+
+  // a track at rest at (px, py) with covariance sigma_init*I
+  void add(float px, float py)
+  {
+    x.push_back(px);
+    y.push_back(py);
+    vx.push_back(0);
+    vy.push_back(0);
+    pxx.push_back(sigma_init);
+    pxv.push_back(0);
+    pvv.push_back(sigma_init);
+    pyy.push_back(sigma_init);
+    pyw.push_back(0);
+    pww.push_back(sigma_init);
+    inv_sx.push_back(0);
+    inv_sy.push_back(0);
+  }
+
+  // drops track i, the last track takes its index
+  void remove(int i)
+  {
+    removeAt(x, i);
+    removeAt(y, i);
+    removeAt(vx, i);
+    removeAt(vy, i);
+    removeAt(pxx, i);
+    removeAt(pxv, i);
+    removeAt(pvv, i);
+    removeAt(pyy, i);
+    removeAt(pyw, i);
+    removeAt(pww, i);
+    removeAt(inv_sx, i);
+    removeAt(inv_sy, i);
+  }
+
+  // Predicts all tracks one frame ahead and updates inv_sx, inv_sy.
+  void predict()
+  {
+    const int n = size();
+    if (n == 0)
+      return;
+
+    const float a = velocity_decay;
+    const float q = sigma_p;
+    const float r = sigma_q;
+    float *x_ = &x[0], *y_ = &y[0], *vx_ = &vx[0], *vy_ = &vy[0];
+    float *pxx_ = &pxx[0], *pxv_ = &pxv[0], *pvv_ = &pvv[0];
+    float *pyy_ = &pyy[0], *pyw_ = &pyw[0], *pww_ = &pww[0];
+    float *isx = &inv_sx[0], *isy = &inv_sy[0];
+
+    for (int i = 0; i < n; i++)
+    {
+      x_[i] += vx_[i];
+      y_[i] += vy_[i];
+      vx_[i] *= a;
+      vy_[i] *= a;
+
+      // F P F' + Q per axis, F = [1 1; 0 a]
+      const float xx = pxx_[i] + 2*pxv_[i] + pvv_[i] + q;
+      const float xv = a*(pxv_[i] + pvv_[i]);
+      const float vv = a*a*pvv_[i] + q;
+      const float yy = pyy_[i] + 2*pyw_[i] + pww_[i] + q;
+      const float yw = a*(pyw_[i] + pww_[i]);
+      const float ww = a*a*pww_[i] + q;
+      pxx_[i] = xx;
+      pxv_[i] = xv;
+      pvv_[i] = vv;
+      pyy_[i] = yy;
+      pyw_[i] = yw;
+      pww_[i] = ww;
+
+      isx[i] = 1.0f/(xx + r);
+      isy[i] = 1.0f/(yy + r);
+    }
+  }
+
+  // squared Mahalanobis distance of a measurement of track i, after predict
+  float mahalanobis2(int i, float mx, float my) const
+  {
+    const float ex = mx - x[i];
+    const float ey = my - y[i];
+    return ex*ex*inv_sx[i] + ey*ey*inv_sy[i];
+  }
+
+  // Corrects every track i with weight[i] 1 by the measurement (zx[i], zy[i]),
+  // after predict. Tracks with weight 0 are left as they are, their zx, zy
+  // only have to be finite.
+  void correct(const float *zx, const float *zy, const float *weight)
+  {
+    const int n = size();
+    if (n == 0)
+      return;
+
+    float *x_ = &x[0], *y_ = &y[0], *vx_ = &vx[0], *vy_ = &vy[0];
+    float *pxx_ = &pxx[0], *pxv_ = &pxv[0], *pvv_ = &pvv[0];
+    float *pyy_ = &pyy[0], *pyw_ = &pyw[0], *pww_ = &pww[0];
+    const float *isx = &inv_sx[0], *isy = &inv_sy[0];
+
+    for (int i = 0; i < n; i++)
+    {
+      // K = P H' S^-1, the position column of P over the innovation variance
+      const float kx = weight[i]*pxx_[i]*isx[i];
+      const float kv = weight[i]*pxv_[i]*isx[i];
+      const float ky = weight[i]*pyy_[i]*isy[i];
+      const float kw = weight[i]*pyw_[i]*isy[i];
+      const float ex = zx[i] - x_[i];
+      const float ey = zy[i] - y_[i];
+
+      x_[i] += kx*ex;
+      vx_[i] += kv*ex;
+      y_[i] += ky*ey;
+      vy_[i] += kw*ey;
+
+      // P - K H P
+      pvv_[i] -= kv*pxv_[i];
+      pxv_[i] -= kx*pxv_[i];
+      pxx_[i] -= kx*pxx_[i];
+      pww_[i] -= kw*pyw_[i];
+      pyw_[i] -= ky*pyw_[i];
+      pyy_[i] -= ky*pyy_[i];
+    }
+  }
+
+  float velocity_decay;
+  float sigma_p, sigma_q;
+  float sigma_init;
+
+  // state of track i
+  std::vector<float> x, y, vx, vy;
+  // covariance blocks of the x axis (x, vx) and the y axis (y, vy)
+  std::vector<float> pxx, pxv, pvv;
+  std::vector<float> pyy, pyw, pww;
+  // inverse innovation variances from the last predict
+  std::vector<float> inv_sx, inv_sy;
+
+private:
+  static void removeAt(std::vector<float> &v, int i)
+  {
+    v[i] = v.back();
+    v.pop_back();
+  }
+};
+
+#endif // KF_TRACKER_BATCH_KALMAN_H
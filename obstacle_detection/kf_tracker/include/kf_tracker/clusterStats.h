@@ -0,0 +1,112 @@
+//
+// MIT License
+//
+// Copyright (c) 2017 MRSD Team D - LoCo
+// The Robotics Institute, Carnegie Mellon University
+// http://mrsdprojects.ri.cmu.edu/2016teamd/
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef KF_TRACKER_CLUSTER_STATS_H
+#define KF_TRACKER_CLUSTER_STATS_H
+
+#include <algorithm>
+#include <cmath>
+
+// Point count, centroid, bounding box and principal axis of a planar
+// cluster, accumulated in one pass over its points without copying them.
+
+struct ClusterStats
+{
+  int n_points;
+  float x, y;                       // centroid [m]
+  float min_x, max_x, min_y, max_y;
+  float axis_x, axis_y;             // unit direction of the largest spread
+};
+
+class ClusterAccumulator
+{
+public:
+  ClusterAccumulator(): n_(0)
+  {
+  }
+
+  void reset() { n_ = 0; }
+  int size() const { return n_; }
+
+  void add(float x, float y)
+  {
+    if (n_ == 0)
+    {
+      x0_ = x;
+      y0_ = y;
+      sx_ = sy_ = sxx_ = sxy_ = syy_ = 0;
+      min_x_ = max_x_ = x;
+      min_y_ = max_y_ = y;
+    }
+    else
+    {
+      min_x_ = std::min(min_x_, x);
+      max_x_ = std::max(max_x_, x);
+      min_y_ = std::min(min_y_, y);
+      max_y_ = std::max(max_y_, y);
+    }
+
+    // sums about the first point, which keeps the second moments well
+    // conditioned far from the origin
+    const float dx = x - x0_;
+    const float dy = y - y0_;
+    sx_ += dx;
+    sy_ += dy;
+    sxx_ += dx*dx;
+    sxy_ += dx*dy;
+    syy_ += dy*dy;
+    n_++;
+  }
+
+  // needs at least one point
+  void finish(ClusterStats &s) const
+  {
+    const float mx = sx_/n_;
+    const float my = sy_/n_;
+    const float cxx = sxx_/n_ - mx*mx;
+    const float cxy = sxy_/n_ - mx*my;
+    const float cyy = syy_/n_ - my*my;
+    const float a = 0.5f*atan2(2*cxy, cxx - cyy);
+
+    s.n_points = n_;
+    s.x = x0_ + mx;
+    s.y = y0_ + my;
+    s.min_x = min_x_;
+    s.max_x = max_x_;
+    s.min_y = min_y_;
+    s.max_y = max_y_;
+    s.axis_x = cos(a);
+    s.axis_y = sin(a);
+  }
+
+private:
+  int n_;
+  float x0_, y0_;
+  float sx_, sy_, sxx_, sxy_, syy_;
+  float min_x_, max_x_, min_y_, max_y_;
+};
+
+#endif // KF_TRACKER_CLUSTER_STATS_H
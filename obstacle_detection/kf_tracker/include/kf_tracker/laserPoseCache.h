@@ -0,0 +1,98 @@
+//
+// MIT License
+//
+// Copyright (c) 2017 MRSD Team D - LoCo
+// The Robotics Institute, Carnegie Mellon University
+// http://mrsdprojects.ri.cmu.edu/2016teamd/
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef KF_TRACKER_LASER_POSE_CACHE_H
+#define KF_TRACKER_LASER_POSE_CACHE_H
+
+#include <string>
+#include <ros/ros.h>
+#include <nav_msgs/Odometry.h>
+#include <tf/transform_listener.h>
+
+// Planar pose of the laser in the map frame.
+struct LaserPose
+{
+  double x, y, yaw;
+  double c, s;      // cos and sin of yaw
+
+  // a point in the laser frame to the map frame
+  void toMap(double lx, double ly, double &mx, double &my) const
+  {
+    mx = x + c*lx - s*ly;
+    my = y + s*lx + c*ly;
+  }
+};
+
+// Map-to-laser poses at the time of a scan, without waiting on tf.
+//
+// The robot pose in the map frame comes from the state estimate on
+// odometry/filtered, the same one the planner uses, and goes into a ring of
+// the last RING_SIZE messages. A lookup interpolates between the two poses
+// around the stamp, found a few steps back from the newest, or extrapolates
+// the newest with its twist up to max_extrapolation ahead. The fixed
+// base-to-laser offset is taken from tf once it is available, with a
+// non-blocking query. The ring has a single writer, the odometry callback,
+// and readers never lock it: they copy the poses they need and discard them
+// if the writer lapped them meanwhile.
+class LaserPoseCache
+{
+public:
+  LaserPoseCache(ros::NodeHandle &nh, const std::string &laser_frame = "laser",
+                 const std::string &base_frame = "base_link",
+                 const std::string &odom_topic = "odometry/filtered");
+
+  // Pose of the laser at stamp, or at the newest odometry for ros::Time(0).
+  // False if stamp is older than the ring or too far past its newest pose,
+  // or the laser offset is not known yet.
+  bool lookup(const ros::Time &stamp, LaserPose &pose);
+
+  double max_extrapolation;   // [s]
+
+private:
+  enum { RING_SIZE = 64 };
+
+  struct Sample
+  {
+    double t;
+    double x, y, yaw;
+    double vx, vy, wz;  // twist in the robot frame
+  };
+
+  void odomCb(const nav_msgs::Odometry &msg);
+  bool updateOffset();
+
+  ros::Subscriber sub_;
+  tf::TransformListener listener_;
+  std::string laser_frame_, base_frame_;
+
+  Sample ring_[RING_SIZE];
+  unsigned long head_;        // samples written so far, published last
+
+  bool have_offset_;
+  double off_x_, off_y_, off_yaw_;
+};
+
+#endif // KF_TRACKER_LASER_POSE_CACHE_H
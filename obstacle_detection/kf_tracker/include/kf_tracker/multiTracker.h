@@ -0,0 +1,90 @@
+//
+// MIT License
+//
+// Copyright (c) 2017 MRSD Team D - LoCo
+// The Robotics Institute, Carnegie Mellon University
+// http://mrsdprojects.ri.cmu.edu/2016teamd/
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef KF_TRACKER_MULTI_TRACKER_H
+#define KF_TRACKER_MULTI_TRACKER_H
+
+#include <vector>
+#include "kf_tracker/batchKalman.h"
+
+// Tracks any number of obstacles with one constant-velocity Kalman filter each.
+// Every frame all tracks are predicted, detections inside a track's
+// Mahalanobis gate are candidates for it, and the Hungarian algorithm picks
+// the assignment with the least total squared Mahalanobis distance. Matched
+// tracks are corrected, unmatched detections start new tracks and tracks that
+// go unmatched too long are dropped. A track counts as confirmed once it has
+// been matched confirm_hits times.
+
+class MultiTracker
+{
+public:
+  MultiTracker();
+
+  // One frame of detections, in the frame the tracks are kept in.
+  void update(const std::vector<float> &det_x, const std::vector<float> &det_y);
+
+  // Track i of 0..size()-1; indices change as tracks come and go, ids do not.
+  int size() const { return kf_.size(); }
+  int id(int i) const { return id_[i]; }
+  int hits(int i) const { return hits_[i]; }
+  bool confirmed(int i) const { return hits_[i] >= confirm_hits; }
+  // states and covariances, indexed like the tracks
+  const BatchKalman &filter() const { return kf_; }
+
+  float velocity_decay;   // v' = velocity_decay*v
+  float sigma_p, sigma_q; // process and measurement noise
+  float sigma_init;       // initial state covariance of a new track
+  float gate;             // squared Mahalanobis distance, chi2 with 2 dof
+  int confirm_hits;
+  int max_misses;
+  int max_tracks;
+
+protected:
+  // fills track_det_ with the detection of every track, -1 for none
+  void assign(int n_tracks, int n_dets);
+
+  // assignment scratch, kept from frame to frame; the tests fill cost_ and
+  // call assign directly
+  std::vector<float> cost_;   // n x n row major, n = max(tracks, detections)
+  std::vector<double> u_, v_, minv_;
+  std::vector<int> p_, way_;
+  std::vector<char> used_;
+  std::vector<int> track_det_;
+  std::vector<char> det_used_;
+
+private:
+  void startTrack(float x, float y);
+  void removeTrack(int i);
+
+  BatchKalman kf_;
+  std::vector<int> id_, hits_, misses_;  // frames with a detection, consecutive frames without
+  int next_id_;
+
+  // measurement of every track, weight 0 for none
+  std::vector<float> zx_, zy_, weight_;
+};
+
+#endif // KF_TRACKER_MULTI_TRACKER_H
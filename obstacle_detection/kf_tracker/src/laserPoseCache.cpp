@@ -0,0 +1,140 @@
+//
+// MIT License
+//
+// Copyright (c) 2017 MRSD Team D - LoCo
+// The Robotics Institute, Carnegie Mellon University
+// http://mrsdprojects.ri.cmu.edu/2016teamd/
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "kf_tracker/laserPoseCache.h"
+#include <cmath>
+
+static double wrapAngle(double a)
+{
+  return atan2(sin(a), cos(a));
+}
+
+LaserPoseCache::LaserPoseCache(ros::NodeHandle &nh, const std::string &laser_frame,
+                               const std::string &base_frame, const std::string &odom_topic)
+  : max_extrapolation(0.1), listener_(ros::Duration(10)), laser_frame_(laser_frame),
+    base_frame_(base_frame), head_(0), have_offset_(false), off_x_(0), off_y_(0), off_yaw_(0)
+{
+  sub_ = nh.subscribe(odom_topic, 10, &LaserPoseCache::odomCb, this);
+}
+
+void LaserPoseCache::odomCb(const nav_msgs::Odometry &msg)
+{
+  const unsigned long head = head_;
+  Sample &s = ring_[head % RING_SIZE];
+  s.t = msg.header.stamp.toSec();
+  s.x = msg.pose.pose.position.x;
+  s.y = msg.pose.pose.position.y;
+  s.yaw = tf::getYaw(msg.pose.pose.orientation);
+  s.vx = msg.twist.twist.linear.x;
+  s.vy = msg.twist.twist.linear.y;
+  s.wz = msg.twist.twist.angular.z;
+  __atomic_store_n(&head_, head + 1, __ATOMIC_RELEASE);
+}
+
+// the static part, asked for without waiting until tf has it
+bool LaserPoseCache::updateOffset()
+{
+  if (have_offset_)
+    return true;
+
+  if (!listener_.canTransform(base_frame_, laser_frame_, ros::Time(0)))
+    return false;
+
+  try
+  {
+    tf::StampedTransform t;
+    listener_.lookupTransform(base_frame_, laser_frame_, ros::Time(0), t);
+    off_x_ = t.getOrigin().x();
+    off_y_ = t.getOrigin().y();
+    off_yaw_ = tf::getYaw(t.getRotation());
+    have_offset_ = true;
+  }
+  catch (tf::TransformException &ex)
+  {
+  }
+  return have_offset_;
+}
+
+bool LaserPoseCache::lookup(const ros::Time &stamp, LaserPose &pose)
+{
+  if (!updateOffset())
+    return false;
+
+  const unsigned long head = __atomic_load_n(&head_, __ATOMIC_ACQUIRE);
+  if (head == 0)
+    return false;
+
+  // Sample i is intact while the writer is at most at i + RING_SIZE - 1, so
+  // leave it one sample to write while we read.
+  const unsigned long oldest = (head > RING_SIZE - 2) ? head - (RING_SIZE - 2) : 0;
+  unsigned long i = head - 1;
+  Sample newer = ring_[i % RING_SIZE];
+  Sample older = newer;
+  const double t = stamp.isZero() ? newer.t : stamp.toSec();
+  bool found = (newer.t <= t);
+  while (!found && i > oldest)
+  {
+    i--;
+    older = ring_[i % RING_SIZE];
+    found = (older.t <= t);
+    if (!found)
+      newer = older;
+  }
+
+  // discard what the writer may have overwritten meanwhile
+  __atomic_thread_fence(__ATOMIC_ACQUIRE);
+  const unsigned long head2 = __atomic_load_n(&head_, __ATOMIC_RELAXED);
+  if (!found || i + RING_SIZE - 1 <= head2)
+    return false;
+
+  double x, y, yaw;
+  if (newer.t <= t)
+  {
+    // at or past the newest sample, move it along its twist
+    const double dt = t - newer.t;
+    if (dt > max_extrapolation)
+      return false;
+    const double c = cos(newer.yaw), s = sin(newer.yaw);
+    x = newer.x + (c*newer.vx - s*newer.vy)*dt;
+    y = newer.y + (s*newer.vx + c*newer.vy)*dt;
+    yaw = newer.yaw + newer.wz*dt;
+  }
+  else
+  {
+    const double w = (t - older.t)/(newer.t - older.t);
+    x = older.x + w*(newer.x - older.x);
+    y = older.y + w*(newer.y - older.y);
+    yaw = older.yaw + w*wrapAngle(newer.yaw - older.yaw);
+  }
+
+  const double c = cos(yaw), s = sin(yaw);
+  pose.x = x + c*off_x_ - s*off_y_;
+  pose.y = y + s*off_x_ + c*off_y_;
+  pose.yaw = wrapAngle(yaw + off_yaw_);
+  pose.c = cos(pose.yaw);
+  pose.s = sin(pose.yaw);
+  return true;
+}
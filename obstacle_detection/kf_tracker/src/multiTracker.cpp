@@ -0,0 +1,196 @@
+//
+// MIT License
+//
+// Copyright (c) 2017 MRSD Team D - LoCo
+// The Robotics Institute, Carnegie Mellon University
+// http://mrsdprojects.ri.cmu.edu/2016teamd/
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "kf_tracker/multiTracker.h"
+#include <algorithm>
+#include <limits>
+
+// cost of a pair outside the gate and of the padding to a square matrix
+static const float NO_MATCH = 1e6f;
+
+MultiTracker::MultiTracker(): velocity_decay(0.01f), sigma_p(0.01f), sigma_q(0.1f), sigma_init(1.0f),
+                              gate(9.21f), confirm_hits(3), max_misses(5), max_tracks(20),
+                              next_id_(0)
+{
+}
+
+void MultiTracker::startTrack(float x, float y)
+{
+  kf_.add(x, y);
+  id_.push_back(next_id_++);
+  hits_.push_back(1);
+  misses_.push_back(0);
+}
+
+void MultiTracker::removeTrack(int i)
+{
+  kf_.remove(i);
+  id_[i] = id_.back();
+  id_.pop_back();
+  hits_[i] = hits_.back();
+  hits_.pop_back();
+  misses_[i] = misses_.back();
+  misses_.pop_back();
+}
+
+// Hungarian algorithm with potentials, O(n^3) on the square cost_. Rows are
+// tracks and columns detections, p_[j] is the row matched to column j, both
+// counted from 1.
+void MultiTracker::assign(int n_tracks, int n_dets)
+{
+  const int n = std::max(n_tracks, n_dets);
+  const double inf = std::numeric_limits<double>::infinity();
+
+  u_.assign(n+1, 0);
+  v_.assign(n+1, 0);
+  p_.assign(n+1, 0);
+  way_.assign(n+1, 0);
+
+  for (int i = 1; i <= n; i++)
+  {
+    p_[0] = i;
+    int j0 = 0;
+    minv_.assign(n+1, inf);
+    used_.assign(n+1, 0);
+    do
+    {
+      used_[j0] = 1;
+      const int i0 = p_[j0];
+      const float *row = &cost_[(i0-1)*n];
+      double delta = inf;
+      int j1 = 0;
+      for (int j = 1; j <= n; j++)
+      {
+        if (used_[j])
+          continue;
+        const double cur = row[j-1] - u_[i0] - v_[j];
+        if (cur < minv_[j])
+        {
+          minv_[j] = cur;
+          way_[j] = j0;
+        }
+        if (minv_[j] < delta)
+        {
+          delta = minv_[j];
+          j1 = j;
+        }
+      }
+      for (int j = 0; j <= n; j++)
+      {
+        if (used_[j])
+        {
+          u_[p_[j]] += delta;
+          v_[j] -= delta;
+        }
+        else
+          minv_[j] -= delta;
+      }
+      j0 = j1;
+    } while (p_[j0] != 0);
+
+    do
+    {
+      const int j1 = way_[j0];
+      p_[j0] = p_[j1];
+      j0 = j1;
+    } while (j0);
+  }
+
+  // padding and pairs outside the gate stay unmatched
+  track_det_.assign(n_tracks, -1);
+  for (int j = 1; j <= n_dets; j++)
+  {
+    const int i = p_[j] - 1;
+    if (i < n_tracks && cost_[i*n + j-1] <= gate)
+      track_det_[i] = j-1;
+  }
+}
+
+void MultiTracker::update(const std::vector<float> &det_x, const std::vector<float> &det_y)
+{
+  const int n_tracks = size();
+  const int n_dets = det_x.size();
+  const int n = std::max(n_tracks, n_dets);
+
+  kf_.velocity_decay = velocity_decay;
+  kf_.sigma_p = sigma_p;
+  kf_.sigma_q = sigma_q;
+  kf_.sigma_init = sigma_init;
+  kf_.predict();
+
+  cost_.assign(n*n, NO_MATCH);
+  for (int i = 0; i < n_tracks; i++)
+  {
+    float *row = &cost_[i*n];
+    for (int j = 0; j < n_dets; j++)
+    {
+      const float d2 = kf_.mahalanobis2(i, det_x[j], det_y[j]);
+      row[j] = (d2 <= gate) ? d2 : NO_MATCH;
+    }
+  }
+
+  if (n_tracks > 0 && n_dets > 0)
+    assign(n_tracks, n_dets);
+  else
+    track_det_.assign(n_tracks, -1);
+
+  zx_.assign(n_tracks, 0);
+  zy_.assign(n_tracks, 0);
+  weight_.assign(n_tracks, 0);
+  det_used_.assign(n_dets, 0);
+  for (int i = 0; i < n_tracks; i++)
+  {
+    const int j = track_det_[i];
+    if (j < 0)
+    {
+      misses_[i]++;
+      continue;
+    }
+
+    zx_[i] = det_x[j];
+    zy_[i] = det_y[j];
+    weight_[i] = 1;
+    hits_[i]++;
+    misses_[i] = 0;
+    det_used_[j] = 1;
+  }
+  if (n_tracks > 0)
+    kf_.correct(&zx_[0], &zy_[0], &weight_[0]);
+
+  for (int i = 0; i < size();)
+  {
+    if (misses_[i] > max_misses)
+      removeTrack(i);
+    else
+      i++;
+  }
+
+  for (int j = 0; j < n_dets && size() < max_tracks; j++)
+  {
+    if (!det_used_[j])
+      startTrack(det_x[j], det_y[j]);
+  }
+}
@@ -37,9 +37,9 @@ So once an obstacle is detected, this node does nothing.
 #include <std_msgs/Int32MultiArray.h>
 #include <sensor_msgs/PointCloud2.h>
 #include <sensor_msgs/LaserScan.h>
-#include <tf/transform_listener.h>
+#include "kf_tracker/laserPoseCache.h"
 
-tf::TransformListener *tran;
+LaserPoseCache *laser_pose;
 ros::Publisher cc_pos;
 ros::Subscriber reset_sub;
 float obs_dist = 0;
@@ -51,21 +51,20 @@ float percent_thres;
 float front_angle;
 float min_index, max_index;
 
-bool transform_laser_to_map(geometry_msgs::PointStamped &pos_laser_frame, geometry_msgs::PointStamped &pos_map_frame)
+// stamp is the time of the scan, ros::Time(0) for the newest pose
+bool transform_laser_to_map(const ros::Time &stamp, geometry_msgs::PointStamped &pos_laser_frame, geometry_msgs::PointStamped &pos_map_frame)
 {
-  try
-  {
-    tf::StampedTransform transform;
-    tran->waitForTransform("map", "laser", ros::Time::now(), ros::Duration(0.01));
-    tran->lookupTransform("map", "laser", ros::Time(0), transform);
-    tran->transformPoint("map", pos_laser_frame, pos_map_frame);
-    return true;
-  }
-  catch (...)
+  LaserPose pose;
+  if (!laser_pose->lookup(stamp, pose))
   {
     ROS_INFO("Naive_obstacle_detector: Map to laser transform not available.");
     return false;
   }
+
+  pose.toMap(pos_laser_frame.point.x, pos_laser_frame.point.y, pos_map_frame.point.x, pos_map_frame.point.y);
+  pos_map_frame.point.z = pos_laser_frame.point.z;
+  pos_map_frame.header.stamp = stamp;
+  return true;
 }
 
 void scan_cb(const sensor_msgs::LaserScanConstPtr &msg)
@@ -100,7 +99,7 @@ void scan_cb(const sensor_msgs::LaserScanConstPtr &msg)
     cluster_pos_localframe.point.x = obs_dist;
     cluster_pos_localframe.point.y = 0;
 
-    if (transform_laser_to_map(cluster_pos_localframe, cluster_pos_mapframe))
+    if (transform_laser_to_map(msg->header.stamp, cluster_pos_localframe, cluster_pos_mapframe))
     {
       cluster_pos_mapframe.point.y = 0;
       cc_pos.publish(cluster_pos_mapframe);
@@ -125,7 +124,7 @@ void insert_fake_obs()
 
   cluster_pos_localframe.point.x = obstacle_thres;
   cluster_pos_localframe.point.y = 0;
-  if (transform_laser_to_map(cluster_pos_localframe, cluster_pos_mapframe))
+  if (transform_laser_to_map(ros::Time(0), cluster_pos_localframe, cluster_pos_mapframe))
   {
     cluster_pos_mapframe.point.y = 0;
     cc_pos.publish(cluster_pos_mapframe);
@@ -174,8 +173,8 @@ int main(int argc, char **argv) {
   min_index = floor((old_angle-new_angle_max) / increment);
   max_index = 1080 - min_index;
 
-  tf::TransformListener lr(ros::Duration(10));
-  tran = &lr;
+  LaserPoseCache lp(nh, "laser");
+  laser_pose = &lp;
 
   cc_pos = nh.advertise<geometry_msgs::PointStamped>("cluster_center", 1); // clusterCenter1
 
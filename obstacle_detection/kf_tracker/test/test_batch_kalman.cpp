@@ -0,0 +1,206 @@
+//
+// MIT License
+//
+// Copyright (c) 2017 MRSD Team D - LoCo
+// The Robotics Institute, Carnegie Mellon University
+// http://mrsdprojects.ri.cmu.edu/2016teamd/
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+// BatchKalman, which keeps the two axes of every track as separate 2x2
+// blocks, against a dense filter on the full [x vx y vy] state.
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdlib.h>
+
+#include "kf_tracker/batchKalman.h"
+
+namespace {
+
+double uniform(double lo, double hi)
+{
+  return lo + (hi - lo)*rand()/(double)RAND_MAX;
+}
+
+// Textbook Kalman filter on s = [x vx y vy] with the model of BatchKalman
+struct DenseKalman
+{
+  double s[4];
+  double P[4][4];
+
+  DenseKalman(double px, double py, double sigma_init)
+  {
+    s[0] = px;
+    s[1] = 0;
+    s[2] = py;
+    s[3] = 0;
+    for (int i = 0; i < 4; i++)
+      for (int j = 0; j < 4; j++)
+        P[i][j] = (i == j) ? sigma_init : 0;
+  }
+
+  void predict(double a, double q)
+  {
+    double F[4][4] = {{1, 1, 0, 0}, {0, a, 0, 0}, {0, 0, 1, 1}, {0, 0, 0, a}};
+    double s1[4] = {0, 0, 0, 0};
+    double FP[4][4] = {{0}};
+    for (int i = 0; i < 4; i++)
+      for (int k = 0; k < 4; k++)
+      {
+        s1[i] += F[i][k]*s[k];
+        for (int j = 0; j < 4; j++)
+          FP[i][j] += F[i][k]*P[k][j];
+      }
+    for (int i = 0; i < 4; i++)
+    {
+      s[i] = s1[i];
+      for (int j = 0; j < 4; j++)
+      {
+        P[i][j] = (i == j) ? q : 0;
+        for (int k = 0; k < 4; k++)
+          P[i][j] += FP[i][k]*F[j][k];
+      }
+    }
+  }
+
+  // H picks x and y, R = r*I
+  void correct(double zx, double zy, double r)
+  {
+    const int h[2] = {0, 2};
+    double S[2][2];
+    for (int i = 0; i < 2; i++)
+      for (int j = 0; j < 2; j++)
+        S[i][j] = P[h[i]][h[j]] + (i == j ? r : 0);
+    const double det = S[0][0]*S[1][1] - S[0][1]*S[1][0];
+    const double Si[2][2] = {{S[1][1]/det, -S[0][1]/det}, {-S[1][0]/det, S[0][0]/det}};
+
+    double K[4][2];
+    for (int i = 0; i < 4; i++)
+      for (int j = 0; j < 2; j++)
+        K[i][j] = P[i][h[0]]*Si[0][j] + P[i][h[1]]*Si[1][j];
+
+    const double e[2] = {zx - s[0], zy - s[2]};
+    for (int i = 0; i < 4; i++)
+      s[i] += K[i][0]*e[0] + K[i][1]*e[1];
+
+    double KHP[4][4];
+    for (int i = 0; i < 4; i++)
+      for (int j = 0; j < 4; j++)
+        KHP[i][j] = K[i][0]*P[h[0]][j] + K[i][1]*P[h[1]][j];
+    for (int i = 0; i < 4; i++)
+      for (int j = 0; j < 4; j++)
+        P[i][j] -= KHP[i][j];
+  }
+};
+
+void expectNear(const BatchKalman &kf, int i, const DenseKalman &ref)
+{
+  const double tol = 1e-4;
+  EXPECT_NEAR(kf.x[i], ref.s[0], tol*(1 + fabs(ref.s[0])));
+  EXPECT_NEAR(kf.vx[i], ref.s[1], tol*(1 + fabs(ref.s[1])));
+  EXPECT_NEAR(kf.y[i], ref.s[2], tol*(1 + fabs(ref.s[2])));
+  EXPECT_NEAR(kf.vy[i], ref.s[3], tol*(1 + fabs(ref.s[3])));
+  EXPECT_NEAR(kf.pxx[i], ref.P[0][0], tol*ref.P[0][0]);
+  EXPECT_NEAR(kf.pxv[i], ref.P[0][1], tol*(ref.P[0][0] + ref.P[1][1]));
+  EXPECT_NEAR(kf.pvv[i], ref.P[1][1], tol*ref.P[1][1]);
+  EXPECT_NEAR(kf.pyy[i], ref.P[2][2], tol*ref.P[2][2]);
+  EXPECT_NEAR(kf.pyw[i], ref.P[2][3], tol*(ref.P[2][2] + ref.P[3][3]));
+  EXPECT_NEAR(kf.pww[i], ref.P[3][3], tol*ref.P[3][3]);
+  // the axes never couple
+  EXPECT_NEAR(ref.P[0][2], 0.0, 1e-12);
+  EXPECT_NEAR(ref.P[1][3], 0.0, 1e-12);
+}
+
+} // namespace
+
+TEST(batch_kalman, matchesDenseFilter)
+{
+  srand(3);
+  const int n_tracks = 7, n_frames = 30;
+
+  for (int trial = 0; trial < 5; trial++)
+  {
+    BatchKalman kf;
+    kf.velocity_decay = uniform(0.0, 1.0);
+    kf.sigma_p = uniform(0.001, 0.1);
+    kf.sigma_q = uniform(0.01, 1.0);
+    kf.sigma_init = uniform(0.1, 2.0);
+
+    std::vector<DenseKalman> ref;
+    for (int i = 0; i < n_tracks; i++)
+    {
+      const float px = uniform(-10, 10), py = uniform(-10, 10);
+      kf.add(px, py);
+      ref.push_back(DenseKalman(px, py, kf.sigma_init));
+    }
+
+    std::vector<float> zx(n_tracks), zy(n_tracks), weight(n_tracks);
+    for (int frame = 0; frame < n_frames; frame++)
+    {
+      kf.predict();
+      for (int i = 0; i < n_tracks; i++)
+      {
+        ref[i].predict(kf.velocity_decay, kf.sigma_p);
+        expectNear(kf, i, ref[i]);
+
+        // the gating distance uses the innovation variance of the predict
+        const double mx = ref[i].s[0] + uniform(-1, 1), my = ref[i].s[2] + uniform(-1, 1);
+        const double ex = mx - ref[i].s[0], ey = my - ref[i].s[2];
+        const double d2 = ex*ex/(ref[i].P[0][0] + kf.sigma_q) + ey*ey/(ref[i].P[2][2] + kf.sigma_q);
+        EXPECT_NEAR(kf.mahalanobis2(i, mx, my), d2, 1e-4*(1 + d2));
+
+        // some tracks go without a measurement this frame
+        weight[i] = (rand() % 4) ? 1 : 0;
+        zx[i] = mx;
+        zy[i] = my;
+      }
+
+      kf.correct(&zx[0], &zy[0], &weight[0]);
+      for (int i = 0; i < n_tracks; i++)
+      {
+        if (weight[i] > 0)
+          ref[i].correct(zx[i], zy[i], kf.sigma_q);
+        expectNear(kf, i, ref[i]);
+      }
+    }
+  }
+}
+
+TEST(batch_kalman, removeMovesLastTrack)
+{
+  BatchKalman kf;
+  kf.add(1, 2);
+  kf.add(3, 4);
+  kf.add(5, 6);
+  kf.remove(0);
+
+  ASSERT_EQ(kf.size(), 2);
+  EXPECT_EQ(kf.x[0], 5);
+  EXPECT_EQ(kf.y[0], 6);
+  EXPECT_EQ(kf.x[1], 3);
+  EXPECT_EQ(kf.y[1], 4);
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
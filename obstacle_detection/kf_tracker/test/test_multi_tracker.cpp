@@ -0,0 +1,214 @@
+//
+// MIT License
+//
+// Copyright (c) 2017 MRSD Team D - LoCo
+// The Robotics Institute, Carnegie Mellon University
+// http://mrsdprojects.ri.cmu.edu/2016teamd/
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+// MultiTracker: the Hungarian assignment against brute force over all
+// permutations, and how tracks are started, confirmed and retired.
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdlib.h>
+#include <algorithm>
+
+#include "kf_tracker/multiTracker.h"
+
+namespace {
+
+const float NO_MATCH = 1e6f;
+
+double uniform(double lo, double hi)
+{
+  return lo + (hi - lo)*rand()/(double)RAND_MAX;
+}
+
+// exposes the assignment step on a cost matrix of our own
+class AssignTracker : public MultiTracker
+{
+public:
+  // n x n row major, NO_MATCH outside the gate
+  std::vector<int> run(const std::vector<float> &cost, int n_tracks, int n_dets)
+  {
+    cost_ = cost;
+    assign(n_tracks, n_dets);
+    return track_det_;
+  }
+};
+
+// lowest total cost over all matchings of rows to columns
+double bruteForce(const std::vector<float> &cost, int n)
+{
+  std::vector<int> perm(n);
+  for (int i = 0; i < n; i++)
+    perm[i] = i;
+  double best = HUGE_VAL;
+  do
+  {
+    double total = 0;
+    for (int i = 0; i < n; i++)
+      total += cost[i*n + perm[i]];
+    best = std::min(best, total);
+  } while (std::next_permutation(perm.begin(), perm.end()));
+  return best;
+}
+
+// total of a track_det_ result, unmatched rows and columns counted at NO_MATCH
+double assignmentCost(const std::vector<float> &cost, int n, const std::vector<int> &track_det)
+{
+  int n_matched = 0;
+  double total = 0;
+  for (int i = 0; i < (int)track_det.size(); i++)
+  {
+    if (track_det[i] >= 0)
+    {
+      total += cost[i*n + track_det[i]];
+      n_matched++;
+    }
+  }
+  return total + (double)(n - n_matched)*NO_MATCH;
+}
+
+std::vector<float> single(float v)
+{
+  return std::vector<float>(1, v);
+}
+
+} // namespace
+
+TEST(multi_tracker, assignMatchesBruteForce)
+{
+  srand(5);
+  AssignTracker tracker;
+
+  for (int trial = 0; trial < 500; trial++)
+  {
+    const int n_tracks = rand() % 7 + 1;
+    const int n_dets = rand() % 7 + 1;
+    const int n = std::max(n_tracks, n_dets);
+    const double p_gated = uniform(0.0, 0.8);
+
+    std::vector<float> cost(n*n, NO_MATCH);
+    for (int i = 0; i < n_tracks; i++)
+      for (int j = 0; j < n_dets; j++)
+        if (uniform(0, 1) >= p_gated)
+          cost[i*n + j] = uniform(0, tracker.gate);
+
+    std::vector<int> track_det = tracker.run(cost, n_tracks, n_dets);
+    ASSERT_EQ((int)track_det.size(), n_tracks);
+
+    std::vector<char> det_used(n_dets, 0);
+    for (int i = 0; i < n_tracks; i++)
+    {
+      const int j = track_det[i];
+      if (j < 0)
+        continue;
+      ASSERT_LT(j, n_dets);
+      EXPECT_LE(cost[i*n + j], tracker.gate);
+      EXPECT_FALSE(det_used[j]) << "detection " << j << " assigned twice";
+      det_used[j] = 1;
+    }
+
+    // most pairs first, then the lowest cost among those
+    const double best = bruteForce(cost, n);
+    EXPECT_NEAR(assignmentCost(cost, n, track_det), best, 1e-3)
+        << n_tracks << " tracks, " << n_dets << " detections, trial " << trial;
+  }
+}
+
+TEST(multi_tracker, confirmsAndRetiresTracks)
+{
+  MultiTracker tracker;
+  tracker.confirm_hits = 3;
+  tracker.max_misses = 2;
+
+  // a target moving at 0.1 per frame
+  tracker.update(single(0.0f), single(0.0f));
+  ASSERT_EQ(tracker.size(), 1);
+  const int id = tracker.id(0);
+  EXPECT_EQ(tracker.hits(0), 1);
+  EXPECT_FALSE(tracker.confirmed(0));
+
+  tracker.update(single(0.1f), single(0.0f));
+  ASSERT_EQ(tracker.size(), 1);
+  EXPECT_FALSE(tracker.confirmed(0));
+
+  tracker.update(single(0.2f), single(0.0f));
+  ASSERT_EQ(tracker.size(), 1);
+  EXPECT_EQ(tracker.id(0), id);
+  EXPECT_EQ(tracker.hits(0), 3);
+  EXPECT_TRUE(tracker.confirmed(0));
+
+  // a second target far outside the gate starts its own track
+  std::vector<float> det_x(2), det_y(2);
+  det_x[0] = 0.3f;
+  det_y[0] = 0.0f;
+  det_x[1] = 50.0f;
+  det_y[1] = 50.0f;
+  tracker.update(det_x, det_y);
+  ASSERT_EQ(tracker.size(), 2);
+  EXPECT_EQ(tracker.id(0), id);
+  EXPECT_NE(tracker.id(1), id);
+  EXPECT_FALSE(tracker.confirmed(1));
+  EXPECT_NEAR(tracker.filter().x[0], 0.3f, 0.1f);
+
+  // both go unseen; tracks survive max_misses frames and go on the next
+  const std::vector<float> none;
+  for (int frame = 0; frame < tracker.max_misses; frame++)
+  {
+    tracker.update(none, none);
+    EXPECT_EQ(tracker.size(), 2);
+  }
+  tracker.update(none, none);
+  EXPECT_EQ(tracker.size(), 0);
+
+  // ids are never reused
+  tracker.update(single(0.0f), single(0.0f));
+  ASSERT_EQ(tracker.size(), 1);
+  EXPECT_GT(tracker.id(0), id + 1);
+}
+
+TEST(multi_tracker, startsAtMostMaxTracks)
+{
+  MultiTracker tracker;
+  tracker.max_tracks = 4;
+
+  std::vector<float> det_x, det_y;
+  for (int j = 0; j < 10; j++)
+  {
+    det_x.push_back(10.0f*j);
+    det_y.push_back(0.0f);
+  }
+  tracker.update(det_x, det_y);
+  EXPECT_EQ(tracker.size(), 4);
+  tracker.update(det_x, det_y);
+  EXPECT_EQ(tracker.size(), 4);
+  for (int i = 0; i < tracker.size(); i++)
+    EXPECT_EQ(tracker.hits(i), 2);
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -1,13 +0,0 @@
-#ifndef KF_H
-#define KF_H
-
-void cluster_extraction (const sensor_msgs::PointCloud2ConstPtr& input, std::vector<pcl::PointIndices>& cluster_indices)
-
-
-
-
-
-
-
-#endif
-
@@ -0,0 +1,73 @@
+//
+// MIT License
+//
+// Copyright (c) 2017 MRSD Team D - LoCo
+// The Robotics Institute, Carnegie Mellon University
+// http://mrsdprojects.ri.cmu.edu/2016teamd/
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef SCAN_SEGMENTATION_H
+#define SCAN_SEGMENTATION_H
+
+#include <vector>
+#include <sensor_msgs/LaserScan.h>
+#include "kf_tracker/clusterStats.h"
+
+// Breakpoint segmentation of a laser scan. The beams are already ordered by
+// angle, so one pass over the ranges finds the clusters: a segment ends where
+// two consecutive valid returns are farther apart than
+//   d_max = r*sin(dphi)/sin(lambda - dphi) + 3*sigma
+// (Borges and Aldon), with r the range of the earlier return and dphi the
+// angle between them. d_max grows with range like the beam spacing does, and
+// invalid returns inside an object widen dphi instead of splitting it.
+// The cluster statistics are accumulated in the same pass, in the laser frame.
+
+struct ScanSegment : ClusterStats
+{
+  int first, last;      // beam indices of the first and last return
+};
+
+class ScanSegmentation
+{
+public:
+  ScanSegmentation();
+
+  // Segments of the beams between angle_min and angle_max with min_points to
+  // max_points returns, in scan order. segments keeps its capacity.
+  void segment(const sensor_msgs::LaserScan &scan, std::vector<ScanSegment> &segments);
+
+  float angle_min, angle_max;   // beam window [rad]
+  float lambda;                 // flattest incidence still seen as one surface [rad]
+  float sigma;                  // range noise [m]
+  int min_points, max_points;
+
+private:
+  void updateTable(const sensor_msgs::LaserScan &scan);
+  void closeSegment(int first, int last, std::vector<ScanSegment> &segments) const;
+
+  // unit vectors of the beams, rebuilt when the scan geometry changes
+  std::vector<float> cos_, sin_;
+  float table_angle_min_, table_increment_;
+
+  ClusterAccumulator acc_;
+};
+
+#endif // SCAN_SEGMENTATION_H
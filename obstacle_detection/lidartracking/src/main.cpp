@@ -4,41 +4,18 @@
 #include <algorithm>
 #include <iterator>
 
-#include <opencv2/core/core.hpp>
-#include <opencv2/highgui/highgui.hpp>
-#include <opencv2/imgproc/imgproc.hpp>
-#include <opencv2/video/video.hpp>
-#include "opencv2/video/tracking.hpp"
 #include <ros/ros.h>
-#include <pcl/io/pcd_io.h>
-#include <pcl/point_types.h>
-#include "pcl_ros/point_cloud.h"
 #include <geometry_msgs/Point.h>
+#include <geometry_msgs/PointStamped.h>
 #include <std_msgs/Float32MultiArray.h>
-#include <std_msgs/Int32MultiArray.h>
-
-#include <sensor_msgs/PointCloud2.h>
-#include <pcl_conversions/pcl_conversions.h>
-#include <pcl/point_cloud.h>
-#include <pcl/point_types.h>
-#include <pcl/common/geometry.h>
-#include <pcl/filters/extract_indices.h>
-#include <pcl/filters/voxel_grid.h>
-#include <pcl/features/normal_3d.h>
-#include <pcl/kdtree/kdtree.h>
-#include <pcl/sample_consensus/method_types.h>
-#include <pcl/sample_consensus/model_types.h>
-#include <pcl/segmentation/sac_segmentation.h>
-#include <pcl/segmentation/extract_clusters.h>
-#include <pcl/common/centroid.h>
- #include <tf/transform_listener.h>
+#include <sensor_msgs/LaserScan.h>
+#include "kf_tracker/laserPoseCache.h"
 #include <visualization_msgs/MarkerArray.h>
 #include <visualization_msgs/Marker.h>
 #include <limits>
 #include <utility>
-#include <pcl/registration/correspondence_estimation.h>
-#include "Kf.h"
-#include <utility>
+#include "scanSegmentation.h"
+#include "kf_tracker/multiTracker.h"
 #include <ctime>
 float obstacle_thres;
 int mode;
@@ -47,15 +24,19 @@ ros::Publisher objID_pub;
 ros::Publisher cc_pos;
 //ros::Publisher markerPub1;
 
-tf::TransformListener* tran;
+LaserPoseCache* laser_pose;
 
-void cluster_extraction (const sensor_msgs::PointCloud2ConstPtr& input, std::vector<pcl::PointIndices>& cluster_indices);
+ScanSegmentation segmentation;
+std::vector<ScanSegment> segments;
+// in-range segments in the map frame, and the obstacles tracked over them
+std::vector<float> det_x, det_y;
+MultiTracker tracker;
 
 int DEBUGMODE = 0;
 
 
 
-void cloud_cb (const sensor_msgs::PointCloud2ConstPtr& input)
+void scan_cb (const sensor_msgs::LaserScanConstPtr& scan)
 
 { 
  if(mode)
@@ -64,107 +45,63 @@ void cloud_cb (const sensor_msgs::PointCloud2ConstPtr& input)
 }
     //initialize the clustercenter
     std_msgs::Float32MultiArray cluster_center;
-    float xcoordinate(9.0f);
-    float ycoordinate(0.0f);
-    float zcoordinate(0.0f);
     static bool obstaclepresent(0);
-    pcl::PointCloud<pcl::PointXYZ>::Ptr input_cloud (new pcl::PointCloud<pcl::PointXYZ>);
     //initialize the clustercenter
     std_msgs::Float32MultiArray clustermapframe;
-    // initialize the clusterindices to be passed to cluster
-    std::vector<pcl::PointIndices> cluster_indices;
-    // do clustering 
-
 
-    pcl::fromROSMsg (*input, *input_cloud);
     clock_t start = clock();
-    cluster_extraction (input, cluster_indices);
-
-
+    // clusters are runs of nearby returns in scan order
+    segmentation.segment(*scan, segments);
 
-/*
-    if ( DEBUGMODE ==1 )
-    {    std:cout<<cluster_indices.size()<<std::endl;
-
-	}*/
-    std::vector<pcl::PointIndices>::const_iterator it;
-    std::vector<int>::const_iterator pit;
-    // Vector of cluster pointclouds
-    std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr > cluster_vec;
+    geometry_msgs::PointStamped laserframe;
+    geometry_msgs::PointStamped mapframe;
+    laserframe.header.frame_id = "laser";  
 
-    // Cluster centroids
-    std::vector<pcl::PointXYZ> clusterCentroids;
+    mapframe.header.frame_id  = "map";
 
-    cluster_center.data.push_back(0);
-    cluster_center.data.push_back(0);
-    cluster_center.data.push_back(0); 
+    // laser pose at the time of the scan
+    LaserPose pose;
+    if (!laser_pose->lookup(scan->header.stamp, pose))
+        return;
 
-    for(it = cluster_indices.begin(); it != cluster_indices.end(); ++it)
+    det_x.clear();
+    det_y.clear();
+    for(int i = 0; i < segments.size(); i++)
     {
-        float x=0.0; float y=0.0;
-        int numPts=0;
-        pcl::PointCloud<pcl::PointXYZ>::Ptr cloud_cluster (new pcl::PointCloud<pcl::PointXYZ>);
-        for(pit = it->indices.begin(); pit != it->indices.end(); pit++)
-        {
-            cloud_cluster->points.push_back(input_cloud->points[*pit]);
-            x+=input_cloud->points[*pit].x;
-            y+=input_cloud->points[*pit].y;
-            numPts++;
-	    
-
-                  
-        }
-
-        pcl::PointXYZ centroid;
-        centroid.x=x/numPts;
-        centroid.y=y/numPts;
-        centroid.z=0.0;
+        const ScanSegment& centroid = segments[i];
  
         if (centroid.x < obstacle_thres && centroid.x > -1*obstacle_thres && centroid.y > -1*obstacle_thres && centroid.y < obstacle_thres && centroid.x != 0 && centroid.y != 0 )
         {
-             
-            xcoordinate = centroid.x;
-            ycoordinate = centroid.y;
-	    zcoordinate = centroid.z;
-	    obstaclepresent = 1;
-
-	    
+            // setting up laserframe coordinates from cluster centers
+            laserframe.point.x = centroid.x;
+            laserframe.point.y = centroid.y;
+            laserframe.point.z = 0.0f;
+
+            // converting laserframe to mapframe 
+            pose.toMap(laserframe.point.x, laserframe.point.y, mapframe.point.x, mapframe.point.y);
+            det_x.push_back(mapframe.point.x);
+            det_y.push_back(mapframe.point.y);
         }
-
-
-	
     };
 
-    Eigen::Vector4f obstaclepoint;
-    geometry_msgs::PointStamped laserframe;
-    geometry_msgs::PointStamped mapframe;
-    laserframe.header.frame_id = "laser";  
-
-    mapframe.header.frame_id  = "map";
-   
- 
-
-    tf::StampedTransform transform;
-
-   // setting up laserframe coordinates from cluster centers
-   laserframe.point.x = xcoordinate;
-   laserframe.point.y = ycoordinate;
-   laserframe.point.z = zcoordinate;
-
-    // converting laserframe to mapframe 
-    try
+    // an obstacle is a track seen in tracker_confirm_hits scans, the one
+    // seen longest if there are several
+    tracker.update(det_x, det_y);
+    int best = -1;
+    for(int i = 0; i < tracker.size(); i++)
     {
-	    tran->waitForTransform("map","laser",ros::Time::now(), ros::Duration(0.01));
-            tran->lookupTransform("map","laser", ros::Time(0), transform);
-            tran->transformPoint("map",laserframe, mapframe);
+        if (tracker.confirmed(i) && (best < 0 || tracker.hits(i) > tracker.hits(best)))
+            best = i;
     }
-    catch (tf::TransformException& ex) 
+    if (best >= 0)
     {
+        mapframe.point.x = tracker.filter().x[best];
+        mapframe.point.y = tracker.filter().y[best];
+        mapframe.point.z = 0;
+        mapframe.header.stamp = scan->header.stamp;
+        obstaclepresent = 1;
     }
 
-
-
-
    if ( DEBUGMODE == 1)
     {
 
@@ -283,20 +220,31 @@ int main(int argc, char** argv)
     ros::init (argc,argv,"naive_detector");
     ros::NodeHandle nh;
     std::cout<<"About to setup callback tracker\n";
-    tf::TransformListener lr(ros::Duration(10));
-    tran=&lr;
+    LaserPoseCache lp(nh, "laser");
+    laser_pose=&lp;
 
+  double front_angle = 0.6;
   try{
     nh.getParam("naive_obstacle_dist_thres", obstacle_thres);
    nh.getParam("setforcontinuousdetection", mode);
+    nh.getParam("scan_clip_angle", front_angle);
+    nh.getParam("segment_lambda", segmentation.lambda);
+    nh.getParam("segment_sigma", segmentation.sigma);
+    nh.getParam("segment_min_points", segmentation.min_points);
+    nh.getParam("segment_max_points", segmentation.max_points);
+    nh.getParam("tracker_gate", tracker.gate);
+    nh.getParam("tracker_confirm_hits", tracker.confirm_hits);
+    nh.getParam("tracker_max_misses", tracker.max_misses);
   }
   catch(...){
     ROS_ERROR("Need param obstacle_thres");
     ros::shutdown();
   }
+  segmentation.angle_min = -front_angle/2;
+  segmentation.angle_max = front_angle/2;
 
 
-    ros::Subscriber sub = nh.subscribe ("scan_cloud", 1, cloud_cb);
+    ros::Subscriber sub = nh.subscribe ("scan", 1, scan_cb);
   ros::Subscriber mode_sub = nh.subscribe("client_command", 1, mode_cb);
     cc_pos=nh.advertise<geometry_msgs::PointStamped>("cluster_center",100);//clusterCenter1
 
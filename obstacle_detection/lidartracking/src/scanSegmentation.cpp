@@ -0,0 +1,132 @@
+//
+// MIT License
+//
+// Copyright (c) 2017 MRSD Team D - LoCo
+// The Robotics Institute, Carnegie Mellon University
+// http://mrsdprojects.ri.cmu.edu/2016teamd/
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#include "scanSegmentation.h"
+#include <algorithm>
+#include <cmath>
+
+ScanSegmentation::ScanSegmentation(): angle_min(-M_PI), angle_max(M_PI), lambda(0.17), sigma(0.01),
+                                      min_points(10), max_points(100),
+                                      table_angle_min_(0), table_increment_(0)
+{
+}
+
+void ScanSegmentation::updateTable(const sensor_msgs::LaserScan &scan)
+{
+  const int n = scan.ranges.size();
+
+  if ((int) cos_.size() == n && table_angle_min_ == scan.angle_min && table_increment_ == scan.angle_increment)
+    return;
+
+  cos_.resize(n);
+  sin_.resize(n);
+  for (int i = 0; i < n; i++)
+  {
+    double a = scan.angle_min + i*scan.angle_increment;
+    cos_[i] = cos(a);
+    sin_[i] = sin(a);
+  }
+  table_angle_min_ = scan.angle_min;
+  table_increment_ = scan.angle_increment;
+}
+
+void ScanSegmentation::closeSegment(int first, int last, std::vector<ScanSegment> &segments) const
+{
+  if (acc_.size() < min_points || acc_.size() > max_points)
+    return;
+
+  ScanSegment s;
+  acc_.finish(s);
+  s.first = first;
+  s.last = last;
+  segments.push_back(s);
+}
+
+void ScanSegmentation::segment(const sensor_msgs::LaserScan &scan, std::vector<ScanSegment> &segments)
+{
+  segments.clear();
+
+  const int n = scan.ranges.size();
+  const float inc = scan.angle_increment;
+  if (n == 0 || inc <= 0 || lambda <= inc)
+    return;
+
+  updateTable(scan);
+
+  int first = std::max(0, (int) ceil((angle_min - scan.angle_min)/inc));
+  int last = std::min(n-1, (int) floor((angle_max - scan.angle_min)/inc));
+
+  // d_max of adjacent beams, per meter of range
+  const float d_adjacent = sin(inc)/sin(lambda - inc);
+  const float noise = 3*sigma;
+
+  float prev_x = 0, prev_y = 0, prev_r = 0;
+  int prev = -1, seg_first = 0;
+  acc_.reset();
+
+  for (int i = first; i <= last; i++)
+  {
+    const float r = scan.ranges[i];
+    // also false for nan
+    if (!(r >= scan.range_min && r <= scan.range_max))
+      continue;
+
+    const float x = r*cos_[i];
+    const float y = r*sin_[i];
+
+    if (prev >= 0)
+    {
+      const float dx = x - prev_x;
+      const float dy = y - prev_y;
+      float d_max;
+      if (i - prev == 1)
+        d_max = prev_r*d_adjacent + noise;
+      else
+      {
+        const float dphi = (i - prev)*inc;
+        d_max = (dphi < lambda) ? prev_r*sin(dphi)/sin(lambda - dphi) + noise : 0;
+      }
+
+      if (dx*dx + dy*dy > d_max*d_max)
+      {
+        closeSegment(seg_first, prev, segments);
+        acc_.reset();
+      }
+    }
+
+    if (acc_.size() == 0)
+      seg_first = i;
+    acc_.add(x, y);
+
+    prev = i;
+    prev_x = x;
+    prev_y = y;
+    prev_r = r;
+  }
+
+  if (prev >= 0)
+    closeSegment(seg_first, prev, segments);
+}
@@ -0,0 +1,271 @@
+//
+// MIT License
+//
+// Copyright (c) 2017 MRSD Team D - LoCo
+// The Robotics Institute, Carnegie Mellon University
+// http://mrsdprojects.ri.cmu.edu/2016teamd/
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+// ScanSegmentation::segment on synthetic scans: range jumps, gaps of
+// invalid returns, the lambda limit on gaps and the beam window; and the
+// statistics of ClusterAccumulator against a two pass reference.
+
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdlib.h>
+#include <limits>
+
+#include "scanSegmentation.h"
+
+namespace {
+
+const float INC = 0.01f;
+const float ANGLE_MIN = -1.0f;
+
+// n beams, all without a return
+sensor_msgs::LaserScan emptyScan(int n)
+{
+  sensor_msgs::LaserScan scan;
+  scan.angle_min = ANGLE_MIN;
+  scan.angle_increment = INC;
+  scan.angle_max = ANGLE_MIN + (n-1)*INC;
+  scan.range_min = 0.1f;
+  scan.range_max = 30.0f;
+  scan.ranges.assign(n, std::numeric_limits<float>::quiet_NaN());
+  return scan;
+}
+
+// an arc of range r on beams first..last
+void arc(sensor_msgs::LaserScan &scan, int first, int last, float r)
+{
+  for (int i = first; i <= last; i++)
+    scan.ranges[i] = r;
+}
+
+// ClusterStats of the given points, in double and two passes
+void reference(const std::vector<float> &px, const std::vector<float> &py, ClusterStats &s,
+               double &cxx, double &cxy, double &cyy)
+{
+  const int n = px.size();
+  double mx = 0, my = 0;
+  for (int i = 0; i < n; i++)
+  {
+    mx += px[i];
+    my += py[i];
+  }
+  mx /= n;
+  my /= n;
+
+  cxx = cxy = cyy = 0;
+  for (int i = 0; i < n; i++)
+  {
+    cxx += (px[i] - mx)*(px[i] - mx);
+    cxy += (px[i] - mx)*(py[i] - my);
+    cyy += (py[i] - my)*(py[i] - my);
+  }
+  cxx /= n;
+  cxy /= n;
+  cyy /= n;
+
+  s.n_points = n;
+  s.x = mx;
+  s.y = my;
+  s.min_x = *std::min_element(px.begin(), px.end());
+  s.max_x = *std::max_element(px.begin(), px.end());
+  s.min_y = *std::min_element(py.begin(), py.end());
+  s.max_y = *std::max_element(py.begin(), py.end());
+}
+
+// s against the reference statistics of the valid returns of beams first..last
+void expectStats(const sensor_msgs::LaserScan &scan, int first, int last, const ClusterStats &s)
+{
+  std::vector<float> px, py;
+  for (int i = first; i <= last; i++)
+  {
+    const float r = scan.ranges[i];
+    if (!(r >= scan.range_min && r <= scan.range_max))
+      continue;
+    const double a = scan.angle_min + i*scan.angle_increment;
+    px.push_back(r*cos(a));
+    py.push_back(r*sin(a));
+  }
+
+  ClusterStats ref;
+  double cxx, cxy, cyy;
+  reference(px, py, ref, cxx, cxy, cyy);
+  EXPECT_EQ(s.n_points, ref.n_points);
+  EXPECT_NEAR(s.x, ref.x, 1e-4);
+  EXPECT_NEAR(s.y, ref.y, 1e-4);
+  EXPECT_NEAR(s.min_x, ref.min_x, 1e-5);
+  EXPECT_NEAR(s.max_x, ref.max_x, 1e-5);
+  EXPECT_NEAR(s.min_y, ref.min_y, 1e-5);
+  EXPECT_NEAR(s.max_y, ref.max_y, 1e-5);
+}
+
+} // namespace
+
+TEST(cluster_accumulator, matchesTwoPassReference)
+{
+  srand(7);
+  ClusterAccumulator acc;
+
+  for (int trial = 0; trial < 50; trial++)
+  {
+    // a noisy line segment, possibly far from the origin
+    const double cx = (rand() % 2) ? 100.0 : 2.0, cy = -cx/2;
+    const double a = 2*M_PI*rand()/RAND_MAX;
+    const int n = rand() % 60 + 5;
+    std::vector<float> px(n), py(n);
+    acc.reset();
+    for (int i = 0; i < n; i++)
+    {
+      const double t = 2.0*rand()/RAND_MAX - 1;
+      const double e = 0.02*(2.0*rand()/RAND_MAX - 1);
+      px[i] = cx + t*cos(a) - e*sin(a);
+      py[i] = cy + t*sin(a) + e*cos(a);
+      acc.add(px[i], py[i]);
+    }
+    ASSERT_EQ(acc.size(), n);
+
+    ClusterStats s, ref;
+    double cxx, cxy, cyy;
+    acc.finish(s);
+    reference(px, py, ref, cxx, cxy, cyy);
+
+    EXPECT_EQ(s.n_points, n);
+    EXPECT_NEAR(s.x, ref.x, 1e-4*(1 + fabs(cx)));
+    EXPECT_NEAR(s.y, ref.y, 1e-4*(1 + fabs(cy)));
+    EXPECT_EQ(s.min_x, ref.min_x);
+    EXPECT_EQ(s.max_x, ref.max_x);
+    EXPECT_EQ(s.min_y, ref.min_y);
+    EXPECT_EQ(s.max_y, ref.max_y);
+
+    // the axis is a unit eigenvector of the largest eigenvalue, up to sign
+    const double l = 0.5*(cxx + cyy) + sqrt(0.25*(cxx - cyy)*(cxx - cyy) + cxy*cxy);
+    EXPECT_NEAR(s.axis_x*s.axis_x + s.axis_y*s.axis_y, 1.0, 1e-5);
+    EXPECT_NEAR(cxx*s.axis_x + cxy*s.axis_y, l*s.axis_x, 1e-3*l);
+    EXPECT_NEAR(cxy*s.axis_x + cyy*s.axis_y, l*s.axis_y, 1e-3*l);
+    EXPECT_GT(fabs(s.axis_x*cos(a) + s.axis_y*sin(a)), 0.999);
+  }
+}
+
+TEST(scan_segmentation, splitsAtRangeJumps)
+{
+  ScanSegmentation seg;
+  sensor_msgs::LaserScan scan = emptyScan(200);
+  arc(scan, 10, 39, 2.0f);
+  arc(scan, 40, 79, 5.0f);
+  // too few returns to be a segment
+  arc(scan, 100, 104, 3.0f);
+
+  std::vector<ScanSegment> segments;
+  seg.segment(scan, segments);
+  ASSERT_EQ(segments.size(), 2u);
+  EXPECT_EQ(segments[0].first, 10);
+  EXPECT_EQ(segments[0].last, 39);
+  expectStats(scan, 10, 39, segments[0]);
+  EXPECT_EQ(segments[1].first, 40);
+  EXPECT_EQ(segments[1].last, 79);
+  expectStats(scan, 40, 79, segments[1]);
+
+  // too many returns
+  seg.max_points = 35;
+  seg.segment(scan, segments);
+  ASSERT_EQ(segments.size(), 1u);
+  EXPECT_EQ(segments[0].first, 10);
+}
+
+TEST(scan_segmentation, bridgesGapsNarrowerThanLambda)
+{
+  ScanSegmentation seg;
+  seg.lambda = 0.17f;
+  sensor_msgs::LaserScan scan = emptyScan(200);
+
+  // 10 beams of nan, an out of range and a too close return inside one arc
+  arc(scan, 0, 29, 2.0f);
+  arc(scan, 40, 59, 2.0f);
+  scan.ranges[45] = 100.0f;
+  scan.ranges[46] = 0.05f;
+  scan.ranges[47] = std::numeric_limits<float>::infinity();
+
+  // the same range after a gap with dphi >= lambda
+  arc(scan, 59 + 18, 59 + 47, 2.0f);
+
+  std::vector<ScanSegment> segments;
+  seg.segment(scan, segments);
+  ASSERT_EQ(segments.size(), 2u);
+  EXPECT_EQ(segments[0].first, 0);
+  EXPECT_EQ(segments[0].last, 59);
+  EXPECT_EQ(segments[0].n_points, 30 + 20 - 3);
+  expectStats(scan, 0, 59, segments[0]);
+  EXPECT_EQ(segments[1].first, 59 + 18);
+  EXPECT_EQ(segments[1].last, 59 + 47);
+  expectStats(scan, 59 + 18, 59 + 47, segments[1]);
+
+  // a wider lambda bridges that gap too
+  seg.lambda = 0.3f;
+  seg.max_points = 1000;
+  seg.segment(scan, segments);
+  ASSERT_EQ(segments.size(), 1u);
+  EXPECT_EQ(segments[0].first, 0);
+  EXPECT_EQ(segments[0].last, 59 + 47);
+}
+
+TEST(scan_segmentation, clipsToTheWindow)
+{
+  ScanSegmentation seg;
+  sensor_msgs::LaserScan scan = emptyScan(200);
+  arc(scan, 0, 59, 2.0f);
+  arc(scan, 80, 119, 4.0f);
+  arc(scan, 150, 199, 6.0f);
+
+  // beams 20.5 to 130.5, the first arc is cut, the last is outside
+  seg.angle_min = ANGLE_MIN + 20.5f*INC;
+  seg.angle_max = ANGLE_MIN + 130.5f*INC;
+  std::vector<ScanSegment> segments;
+  seg.segment(scan, segments);
+  ASSERT_EQ(segments.size(), 2u);
+  EXPECT_EQ(segments[0].first, 21);
+  EXPECT_EQ(segments[0].last, 59);
+  expectStats(scan, 21, 59, segments[0]);
+  EXPECT_EQ(segments[1].first, 80);
+  EXPECT_EQ(segments[1].last, 119);
+
+  // a window wider than the scan keeps every beam
+  seg.angle_min = -10;
+  seg.angle_max = 10;
+  seg.segment(scan, segments);
+  ASSERT_EQ(segments.size(), 3u);
+  EXPECT_EQ(segments[0].first, 0);
+  EXPECT_EQ(segments[2].last, 199);
+
+  // a window that leaves too few beams of an arc drops it
+  seg.angle_min = ANGLE_MIN + 110.5f*INC;
+  seg.angle_max = ANGLE_MIN + 149.5f*INC;
+  seg.segment(scan, segments);
+  EXPECT_TRUE(segments.empty());
+}
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,265 @@
+//
+// MIT License
+//
+// Copyright (c) 2017 MRSD Team D - LoCo
+// The Robotics Institute, Carnegie Mellon University
+// http://mrsdprojects.ri.cmu.edu/2016teamd/
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef PUBLISHPCL_SCAN_PROJECTION_H
+#define PUBLISHPCL_SCAN_PROJECTION_H
+
+#include <sensor_msgs/LaserScan.h>
+#include <sensor_msgs/PointCloud2.h>
+#include "kf_tracker/laserPoseCache.h"
+#include <algorithm>
+#include <vector>
+#include <cmath>
+
+namespace publishpcl
+{
+
+// Projects the beams of a LaserScan between angle_min and angle_max into an
+// x, y, z float cloud in the scan's frame, the points LaserProjection would
+// give without its intensity and index channels. The window is read straight
+// out of the incoming ranges, its beam indices come from the scan's own angle
+// metadata, and the sin/cos of its beams are cached until that changes. The
+// output cloud keeps its buffer from scan to scan.
+//
+// projectDeskewed also corrects for the motion of the laser during the sweep.
+// The beams are time_increment apart, so the time of each beam within the
+// window is cached with its angle, as a fraction of the window.
+class ScanProjection
+{
+public:
+  ScanProjection(double angle_min = -M_PI, double angle_max = M_PI)
+    : first_(0), n_(0), table_angle_min_(0), table_increment_(0), table_size_(0)
+  {
+    setWindow(angle_min, angle_max);
+  }
+
+  void setWindow(double angle_min, double angle_max)
+  {
+    angle_min_ = angle_min;
+    angle_max_ = angle_max;
+    table_valid_ = false;
+  }
+
+  void project(const sensor_msgs::LaserScan &scan, sensor_msgs::PointCloud2 &cloud)
+  {
+    updateTable(scan);
+
+    const int n = n_;
+    const float *r = n ? &scan.ranges[first_] : NULL;
+    const float *c = n ? &cos_[0] : NULL;
+    const float *s = n ? &sin_[0] : NULL;
+    float *x = n ? &x_[0] : NULL;
+    float *y = n ? &y_[0] : NULL;
+
+    // independent lanes, vectorizes
+    for (int i = 0; i < n; i++)
+    {
+      x[i] = r[i]*c[i];
+      y[i] = r[i]*s[i];
+    }
+
+    compact(scan, cloud);
+  }
+
+  // Times of the first and last beam of the window after the scan stamp [s].
+  void beamTimes(const sensor_msgs::LaserScan &scan, double &t_first, double &t_last)
+  {
+    updateTable(scan);
+    t_first = first_*scan.time_increment;
+    t_last = (first_ + std::max(n_ - 1, 0))*scan.time_increment;
+  }
+
+  // Like project, with every beam placed by the pose the laser had when it
+  // was taken. first and last are the laser poses at the beam times of
+  // beamTimes, in a fixed frame, and the poses between them are interpolated
+  // in beam time. The points come out relative to frame, a pose in the same
+  // fixed frame: the laser pose at the scan stamp for a cloud in the laser
+  // frame, or the identity for one in the fixed frame.
+  void projectDeskewed(const sensor_msgs::LaserScan &scan, const LaserPose &first, const LaserPose &last,
+                       const LaserPose &frame, sensor_msgs::PointCloud2 &cloud)
+  {
+    updateTable(scan);
+
+    const int n = n_;
+    const float *r = n ? &scan.ranges[first_] : NULL;
+    const float *c = n ? &cos_[0] : NULL;
+    const float *s = n ? &sin_[0] : NULL;
+    const float *w = n ? &w_[0] : NULL;
+    float *x = n ? &x_[0] : NULL;
+    float *y = n ? &y_[0] : NULL;
+
+    // beam i is at R(phi + w*dyaw) q + t0 + w*dt in frame, q its point in the
+    // laser frame
+    const float dyaw = atan2(sin(last.yaw - first.yaw), cos(last.yaw - first.yaw));
+    const float phi = first.yaw - frame.yaw;
+    const float cphi = cos(phi), sphi = sin(phi);
+    const double ex = first.x - frame.x, ey = first.y - frame.y;
+    const double dx = last.x - first.x, dy = last.y - first.y;
+    const float t0x = frame.c*ex + frame.s*ey, t0y = -frame.s*ex + frame.c*ey;
+    const float dtx = frame.c*dx + frame.s*dy, dty = -frame.s*dx + frame.c*dy;
+
+    // independent lanes, vectorizes; the yaw change over one sweep is small
+    // enough for the second order rotation
+    for (int i = 0; i < n; i++)
+    {
+      const float qx = r[i]*c[i];
+      const float qy = r[i]*s[i];
+      const float a = w[i]*dyaw;
+      const float ca = 1.0f - 0.5f*a*a;
+      const float ux = ca*qx - a*qy;
+      const float uy = a*qx + ca*qy;
+      x[i] = cphi*ux - sphi*uy + t0x + w[i]*dtx;
+      y[i] = sphi*ux + cphi*uy + t0y + w[i]*dty;
+    }
+
+    compact(scan, cloud);
+  }
+
+  // projectDeskewed with the poses of cache, into the laser frame at the
+  // scan stamp, so consumers of scan_cloud see the frame they always did.
+  // False, with cloud as it was, when cache has no pose for the scan.
+  bool projectDeskewed(const sensor_msgs::LaserScan &scan, LaserPoseCache &cache,
+                       sensor_msgs::PointCloud2 &cloud)
+  {
+    double t_first, t_last;
+    LaserPose first, last, frame;
+
+    beamTimes(scan, t_first, t_last);
+    if (!cache.lookup(scan.header.stamp + ros::Duration(t_first), first) ||
+        !cache.lookup(scan.header.stamp + ros::Duration(t_last), last) ||
+        !cache.lookup(scan.header.stamp, frame))
+      return false;
+
+    projectDeskewed(scan, first, last, frame, cloud);
+    return true;
+  }
+
+private:
+  enum { POINT_STEP = 3*sizeof(float) };
+
+  // x_, y_ of the window into the cloud
+  void compact(const sensor_msgs::LaserScan &scan, sensor_msgs::PointCloud2 &cloud)
+  {
+    if (cloud.fields.size() != 3)
+      initCloud(cloud);
+
+    const int n = n_;
+    const float *r = n ? &scan.ranges[first_] : NULL;
+    const float *x = n ? &x_[0] : NULL;
+    const float *y = n ? &y_[0] : NULL;
+
+    // compact the valid returns into the cloud, without branches; the same
+    // test as LaserProjection, which drops nan as well
+    cloud.data.resize(n*POINT_STEP);
+    float *out = n ? reinterpret_cast<float *>(&cloud.data[0]) : NULL;
+    const float range_min = scan.range_min;
+    const float range_max = scan.range_max;
+    int m = 0;
+    for (int i = 0; i < n; i++)
+    {
+      out[3*m] = x[i];
+      out[3*m+1] = y[i];
+      out[3*m+2] = 0.0f;
+      m += (r[i] < range_max && r[i] >= range_min);
+    }
+
+    cloud.header = scan.header;
+    cloud.width = m;
+    cloud.row_step = m*POINT_STEP;
+    cloud.data.resize(cloud.row_step);
+  }
+
+  void updateTable(const sensor_msgs::LaserScan &scan)
+  {
+    if (table_valid_ && table_size_ == scan.ranges.size() && table_angle_min_ == scan.angle_min &&
+        table_increment_ == scan.angle_increment)
+      return;
+
+    const int size = scan.ranges.size();
+    const double inc = scan.angle_increment;
+    first_ = 0;
+    n_ = 0;
+    if (size > 0 && inc > 0)
+    {
+      first_ = std::max(0, (int) ceil((angle_min_ - scan.angle_min)/inc));
+      int last = std::min(size-1, (int) floor((angle_max_ - scan.angle_min)/inc));
+      n_ = std::max(0, last - first_ + 1);
+    }
+
+    cos_.resize(n_);
+    sin_.resize(n_);
+    w_.resize(n_);
+    x_.resize(n_);
+    y_.resize(n_);
+    for (int i = 0; i < n_; i++)
+    {
+      double a = scan.angle_min + (first_ + i)*inc;
+      cos_[i] = cos(a);
+      sin_[i] = sin(a);
+      // beams are evenly spaced in time, from the first of the window at 0
+      // to the last at 1
+      w_[i] = (n_ > 1) ? (double) i/(n_ - 1) : 0.0;
+    }
+
+    table_valid_ = true;
+    table_size_ = scan.ranges.size();
+    table_angle_min_ = scan.angle_min;
+    table_increment_ = scan.angle_increment;
+  }
+
+  static void initCloud(sensor_msgs::PointCloud2 &cloud)
+  {
+    const char *names[3] = {"x", "y", "z"};
+
+    cloud.fields.resize(3);
+    for (int i = 0; i < 3; i++)
+    {
+      cloud.fields[i].name = names[i];
+      cloud.fields[i].offset = i*sizeof(float);
+      cloud.fields[i].datatype = sensor_msgs::PointField::FLOAT32;
+      cloud.fields[i].count = 1;
+    }
+    cloud.height = 1;
+    cloud.point_step = POINT_STEP;
+    cloud.is_bigendian = false;
+    cloud.is_dense = true;
+  }
+
+  double angle_min_, angle_max_;  // window [rad]
+  int first_, n_;                 // beams of the window
+
+  // SoA tables of the window and scratch for the projected beams
+  std::vector<float> cos_, sin_;
+  std::vector<float> w_;            // beam time as a fraction of the window
+  std::vector<float> x_, y_;
+  bool table_valid_;
+  float table_angle_min_, table_increment_;
+  size_t table_size_;
+};
+
+} // namespace publishpcl
+
+#endif // PUBLISHPCL_SCAN_PROJECTION_H
@@ -26,7 +26,7 @@
 
 #include <ros/ros.h>
 #include <laser_assembler/AssembleScans.h>
-#include "laser_geometry/laser_geometry.h"
+#include "publishpcl/scan_projection.h"
 #include <algorithm>
 #include <ros/assert.h>
 #include <tf2/LinearMath/Transform.h>
@@ -37,6 +37,7 @@
 #include <vector>
 #include <math.h>
 #include <ctime>
+#include <boost/shared_ptr.hpp>
 
 class Scan2Cloud {
 public:
@@ -44,47 +45,36 @@ public:
   void scanCallback(const sensor_msgs::LaserScan::ConstPtr& scan);
 private:
   ros::NodeHandle node_;
-  laser_geometry::LaserProjection projector_;
-  tf::TransformListener tfListener_;
+  publishpcl::ScanProjection projection_;
+  boost::shared_ptr<LaserPoseCache> laser_pose_;  // NULL unless deskew_
 
   ros::Publisher point_cloud_publisher_;
   ros::Subscriber scan_sub_;
 
   sensor_msgs::PointCloud2 cloud_;
   double front_angle; // currently 90 degrees
-  double new_angle_min;
-  double new_angle_max;
-  int min_index;
-  int max_index;
-
-  sensor_msgs::LaserScan scan_front;
+  int deskew_;                 // correct for the motion during the sweep
 };
 
 
-Scan2Cloud::Scan2Cloud()
+Scan2Cloud::Scan2Cloud(): front_angle(0), deskew_(0)
 {
    clock_t start = clock();
-  scan_sub_ = node_.subscribe<sensor_msgs::LaserScan> ("scan", 1, &Scan2Cloud::scanCallback, this);
-  point_cloud_publisher_ = node_.advertise<sensor_msgs::PointCloud2> ("scan_cloud", 1, false);
-
-  try{
-    node_.getParam("scan_clip_angle", front_angle);
-  }
-  catch(...){
+  if (!node_.getParam("scan_clip_angle", front_angle)){
     ROS_ERROR("Need param scan_clip_angle!");
     ros::shutdown();
+    return;
   }
+  projection_.setWindow(-front_angle/2, front_angle/2);
 
-  new_angle_min = -front_angle/2;
-  new_angle_max = front_angle/2;
-
-  double old_angle = 2.35619449615;
-  double increment = 0.00436332309619;
-
-  min_index = floor((old_angle-new_angle_max) / increment);
-  max_index = 1080 - min_index;
-
+  // the pose cache subscribes to odometry, only when de-skewing
+  node_.getParam("deskew_scan", deskew_);
+  if (deskew_)
+    laser_pose_.reset(new LaserPoseCache(node_, "laser"));
 
+  // last, scanCallback needs all of the above
+  point_cloud_publisher_ = node_.advertise<sensor_msgs::PointCloud2> ("scan_cloud", 1, false);
+  scan_sub_ = node_.subscribe<sensor_msgs::LaserScan> ("scan", 1, &Scan2Cloud::scanCallback, this);
 }
 
 
@@ -92,14 +82,15 @@ Scan2Cloud::Scan2Cloud()
 void Scan2Cloud::scanCallback(const sensor_msgs::LaserScan::ConstPtr& scan){
 
 
-  //pre-process scans, chopping to front sub-section
-  scan_front = *scan;
-  scan_front.angle_min = new_angle_min;
-  scan_front.angle_max = new_angle_max;
-  std::vector<float> new_data(&scan->ranges[min_index],&scan->ranges[max_index]);
-  scan_front.ranges = new_data;
+  // front sub-section of the scan
+  // without the poses, the uncorrected cloud
+  if (deskew_ && projection_.projectDeskewed(*scan, *laser_pose_, cloud_))
+  {
+    point_cloud_publisher_.publish(cloud_);
+    return;
+  }
 
-  projector_.projectLaser(scan_front, cloud_);
+  projection_.project(*scan, cloud_);
   point_cloud_publisher_.publish(cloud_);
 /*
     clock_t end = clock();
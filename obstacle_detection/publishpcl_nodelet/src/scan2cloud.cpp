@@ -27,7 +27,7 @@
 #include <ros/ros.h>
 #include <nodelet/nodelet.h>
 #include <laser_assembler/AssembleScans.h>
-#include "laser_geometry.h"
+#include "publishpcl/scan_projection.h"
 #include <algorithm>
 #include <ros/assert.h>
 #include <tf2/LinearMath/Transform.h>
@@ -37,6 +37,7 @@
 #include <message_filters/subscriber.h>
 #include <vector>
 #include <math.h>
+#include <boost/shared_ptr.hpp>
 
 #include <iostream>
 
@@ -50,63 +51,53 @@ namespace publishpcl_nodelet // @(namespace)
     Scan2Cloud() = default;
 
   private:
-    laser_geometry::LaserProjection projector_;
-    tf::TransformListener tfListener_;
+    publishpcl::ScanProjection projection_;
+    boost::shared_ptr<LaserPoseCache> laser_pose_;  // NULL unless deskew_
 
     ros::Publisher pcl_pub_;
     ros::Subscriber scan_sub_;
     ros::Timer timer_;
 
     double front_angle_; // currently 90 degrees
-    double new_angle_min_;
-    double new_angle_max_;
-    int min_index_;
-    int max_index_;
+    int deskew_ = 0;                        // correct for the motion during the sweep
 
     sensor_msgs::PointCloud2 cloud_;
-    sensor_msgs::LaserScan scan_front_;
 
 
     virtual void onInit(){
       ros::NodeHandle nh = getNodeHandle();
       ros::NodeHandle& private_nh = getPrivateNodeHandle();
 
-      scan_sub_ = nh.subscribe<sensor_msgs::LaserScan> ("scan", 1, &Scan2Cloud::scanCallback, this);
-      pcl_pub_ = private_nh.advertise<sensor_msgs::PointCloud2> ("scan_cloud", 1, false);
-
-      if (nh.hasParam("my_param")){
+      if (nh.hasParam("scan_clip_angle")){
         nh.getParam("scan_clip_angle", front_angle_);
         // std::cout << "front_angle_ = " << front_angle_ << std::endl;
       }
       else{
         NODELET_INFO_STREAM("Need param scan_clip_angle!");
         ros::shutdown();
+        return;
       }
 
-      new_angle_min_ = -front_angle_/2;
-      new_angle_max_ = front_angle_/2;
+      projection_.setWindow(-front_angle_/2, front_angle_/2);
 
-      double old_angle = 2.35619449615;
-      double increment = 0.00436332309619;
+      // the pose cache subscribes to odometry, only when de-skewing
+      nh.getParam("deskew_scan", deskew_);
+      if (deskew_)
+        laser_pose_.reset(new LaserPoseCache(nh, "laser"));
 
-      min_index_ = floor((old_angle-new_angle_max_) / increment);
-      max_index_ = 1080 - min_index_;
-    //   std::cout << "min_index_ = " << min_index_ << std::endl;
-    //   std::cout << "max_index_ = " << max_index_ << std::endl;
+      // last, callbacks may run on other threads of the manager right away
+      pcl_pub_ = private_nh.advertise<sensor_msgs::PointCloud2> ("scan_cloud", 1, false);
+      scan_sub_ = nh.subscribe<sensor_msgs::LaserScan> ("scan", 1, &Scan2Cloud::scanCallback, this);
     };
 
     void scanCallback(const sensor_msgs::LaserScan::ConstPtr& scan) {
-      scan_front_.header = scan->header;
-      scan_front_.angle_min = new_angle_min_;
-      scan_front_.angle_max = new_angle_max_;
-      scan_front_.angle_increment = scan->angle_increment;
-      scan_front_.time_increment = scan->time_increment;
-      scan_front_.scan_time = scan->scan_time;
-      scan_front_.range_min = scan->range_min;
-      scan_front_.range_max = scan->range_max;
-      scan_front_.ranges.assign(&scan->ranges[min_index_],&scan->ranges[max_index_]);
-
-      projector_.projectLaser(scan_front_, cloud_);
+      // without the poses, the uncorrected cloud
+      if (deskew_ && projection_.projectDeskewed(*scan, *laser_pose_, cloud_)) {
+        pcl_pub_.publish(cloud_);
+        return;
+      }
+
+      projection_.project(*scan, cloud_);
       pcl_pub_.publish(cloud_);
     }
   };